@@ -0,0 +1,81 @@
+/*
+ *  Fixed-rate animation clock.
+ *
+ *  Frames are paced against absolute CLOCK_MONOTONIC deadlines with
+ *  clock_nanosleep(TIMER_ABSTIME), so render time and wakeup latency do
+ *  not add up over a long animation the way a sleep after each frame does.
+ *  When a wakeup is late by a whole period or more, the frames in between
+ *  are skipped and the caller is told how many steps to advance, keeping
+ *  the animation on the wall clock. How late every wakeup was is kept for
+ *  the statistics.
+ */
+#ifndef ANIM_CLOCK_H
+#define ANIM_CLOCK_H
+
+#include <errno.h>
+#include <time.h>
+
+struct anim_clock_t
+{
+    struct timespec next; //deadline of the coming frame
+    long period_ns;
+    unsigned long frames;  //wakeups so far
+    unsigned long skipped; //frames dropped to catch up
+    long long jitter_sum;  //ns every wakeup came after its deadline, summed
+    long jitter_max;
+};
+
+static inline void anim_add_ns(struct timespec *t, long long ns)
+{
+    ns += t->tv_nsec;
+    t->tv_sec += ns / 1000000000L;
+    t->tv_nsec = ns % 1000000000L;
+}
+
+//first deadline one period from now
+static inline void anim_start(struct anim_clock_t *c, unsigned fps)
+{
+    c->period_ns = 1000000000L / (fps ? fps : 1);
+    c->frames = 0;
+    c->skipped = 0;
+    c->jitter_sum = 0;
+    c->jitter_max = 0;
+    clock_gettime(CLOCK_MONOTONIC, &c->next);
+    anim_add_ns(&c->next, c->period_ns);
+}
+
+//sleep until the next frame is due, returns the animation steps to advance: 1 on time,
+//more when frames had to be skipped
+static inline unsigned anim_wait(struct anim_clock_t *c)
+{
+    struct timespec now;
+    long long late;
+    unsigned steps = 1;
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &c->next, NULL) == EINTR)
+        ;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    late = (now.tv_sec - c->next.tv_sec) * 1000000000LL + (now.tv_nsec - c->next.tv_nsec);
+    if (late < 0)
+        late = 0;
+    c->frames++;
+    c->jitter_sum += late;
+    if (late > c->jitter_max)
+        c->jitter_max = late;
+
+    if (late >= c->period_ns)
+    {
+        steps += late / c->period_ns;
+        c->skipped += steps - 1;
+    }
+    anim_add_ns(&c->next, (long long)c->period_ns * steps);
+    return steps;
+}
+
+//mean lateness of a wakeup in ns
+static inline long anim_jitter_mean(const struct anim_clock_t *c)
+{
+    return c->frames ? (long)(c->jitter_sum / (long long)c->frames) : 0;
+}
+
+#endif
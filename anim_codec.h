@@ -0,0 +1,319 @@
+/*
+ *  Delta-compressed animation stream for the 8x8 LED matrix.
+ *
+ *  A stream is an 8 byte header, "RPIA" and a version, followed by frames.
+ *  Every frame is coded against the one before it (all black before the
+ *  first) as a kind byte and a 16-bit display time, then one of:
+ *
+ *    ANIM_SAME  nothing, the frame did not change
+ *    ANIM_MASK  a 64-bit mask of the changed pixels (bit i is pixel i)
+ *               and the new value of each, in pixel order
+ *    ANIM_RLE   ops covering all 64 pixels: skip n unchanged pixels, n
+ *               pixels of one value, or n literal values
+ *
+ *  The encoder writes whichever of the two is shorter, so a frame never
+ *  takes more than ANIM_FRAME_MAX bytes. All fields are little endian.
+ *
+ *  Decoding patches the previous frame in place, so a player keeps one
+ *  8x8 buffer and decodes every frame into it. The reader pulls the stream
+ *  through a small buffer, a file or a FIFO of any length plays in constant
+ *  memory.
+ */
+#ifndef ANIM_CODEC_H
+#define ANIM_CODEC_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "pixel_ops.h"
+
+#define ANIM_MAGIC "RPIA"
+#define ANIM_VERSION 1
+#define ANIM_HEADER 8
+#define ANIM_FRAME_MAX (3 + 8 + 2 * PX_COUNT)
+#define ANIM_READ_BUF 4096
+
+#define ANIM_SAME 0
+#define ANIM_MASK 1
+#define ANIM_RLE 2
+
+//RLE op byte, the low bits hold the count less one
+#define ANIM_OP_SKIP 0x80
+#define ANIM_OP_RUN 0x40
+#define ANIM_OP_LIT 0x00
+#define ANIM_OP_COUNT 0x3F
+
+struct anim_reader_t
+{
+    int fd;
+    int eof;
+    size_t pos, len; //unread bytes are buf[pos] up to buf[len]
+    uint8_t buf[ANIM_READ_BUF];
+};
+
+struct anim_writer_t
+{
+    FILE *out;
+    unsigned long frames, bytes;
+    uint16_t prev[PX_COUNT];
+};
+
+static inline void anim_put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static inline uint16_t anim_get16(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+//pixels from i on that hold the same value in cur, at most ANIM_OP_COUNT + 1
+static inline int anim_run(const uint16_t *cur, int i)
+{
+    int j = i + 1;
+
+    while (j < PX_COUNT && j - i <= ANIM_OP_COUNT && cur[j] == cur[i])
+        j++;
+    return j - i;
+}
+
+//ANIM_RLE payload of cur against prev into out, returns its length
+static inline int anim_encode_rle(uint8_t *out, const uint16_t *prev, const uint16_t *cur)
+{
+    int i = 0, j, n, len = 0;
+
+    while (i < PX_COUNT)
+    {
+        if (cur[i] == prev[i])
+        {
+            for (j = i + 1; j < PX_COUNT && j - i <= ANIM_OP_COUNT && cur[j] == prev[j]; j++)
+                ;
+            out[len++] = ANIM_OP_SKIP | (j - i - 1);
+            i = j;
+            continue;
+        }
+        n = anim_run(cur, i);
+        if (n >= 2)
+        {
+            out[len++] = ANIM_OP_RUN | (n - 1);
+            anim_put16(out + len, cur[i]);
+            len += 2;
+            i += n;
+            continue;
+        }
+        //literals until an unchanged pixel or a run worth its own op
+        for (j = i + 1; j < PX_COUNT && j - i <= ANIM_OP_COUNT && cur[j] != prev[j] && anim_run(cur, j) < 3; j++)
+            ;
+        out[len++] = ANIM_OP_LIT | (j - i - 1);
+        for (; i < j; i++, len += 2)
+            anim_put16(out + len, cur[i]);
+    }
+    return len;
+}
+
+//code cur against prev into out, at least ANIM_FRAME_MAX bytes, returns the bytes written
+static inline int anim_encode(uint8_t *out, const uint16_t *prev, const uint16_t *cur, unsigned duration_ms)
+{
+    uint8_t rle[4 * PX_COUNT];
+    uint64_t mask = 0;
+    int i, len = 3, rle_len;
+
+    anim_put16(out + 1, duration_ms > UINT16_MAX ? UINT16_MAX : duration_ms);
+    for (i = 0; i < PX_COUNT; i++)
+        mask |= (uint64_t)(cur[i] != prev[i]) << i;
+    if (mask == 0)
+    {
+        out[0] = ANIM_SAME;
+        return len;
+    }
+    rle_len = anim_encode_rle(rle, prev, cur);
+    if (rle_len < 8 + 2 * __builtin_popcountll(mask))
+    {
+        out[0] = ANIM_RLE;
+        memcpy(out + len, rle, rle_len);
+        return len + rle_len;
+    }
+    out[0] = ANIM_MASK;
+    for (i = 0; i < 8; i++)
+        out[len++] = mask >> 8 * i;
+    for (; mask; mask &= mask - 1, len += 2)
+        anim_put16(out + len, cur[__builtin_ctzll(mask)]);
+    return len;
+}
+
+//apply the frame at in to pixel, which holds the frame before it; returns the bytes
+//used, 0 when len does not hold the whole frame yet, -1 for a corrupt frame
+static inline int anim_decode(const uint8_t *in, size_t len, uint16_t *pixel, unsigned *duration_ms)
+{
+    uint64_t mask;
+    size_t used = 3;
+    int i, n, op;
+
+    if (len < 3)
+        return 0;
+    if (duration_ms != NULL)
+        *duration_ms = anim_get16(in + 1);
+    switch (in[0])
+    {
+    case ANIM_SAME:
+        return used;
+
+    case ANIM_MASK:
+        if (len < used + 8)
+            return 0;
+        for (i = 0, mask = 0; i < 8; i++)
+            mask |= (uint64_t)in[used++] << 8 * i;
+        if (len < used + 2 * __builtin_popcountll(mask))
+            return 0;
+        for (; mask; mask &= mask - 1, used += 2)
+            pixel[__builtin_ctzll(mask)] = anim_get16(in + used);
+        return used;
+
+    case ANIM_RLE:
+        //check the whole frame is there before touching pixel, a partial frame is retried
+        for (i = 0; i < PX_COUNT; i += n)
+        {
+            if (len < used + 1)
+                return 0;
+            op = in[used++];
+            n = (op & ANIM_OP_COUNT) + 1;
+            if (i + n > PX_COUNT || (op & ANIM_OP_SKIP && op & ANIM_OP_RUN))
+                return -1;
+            used += op & ANIM_OP_SKIP ? 0 : op & ANIM_OP_RUN ? 2 : 2 * n;
+            if (len < used)
+                return 0;
+        }
+        for (i = 0, used = 3; i < PX_COUNT; i += n)
+        {
+            op = in[used++];
+            n = (op & ANIM_OP_COUNT) + 1;
+            if (op & ANIM_OP_SKIP)
+                continue;
+            if (op & ANIM_OP_RUN)
+            {
+                uint16_t v = anim_get16(in + used);
+                used += 2;
+                for (int j = i; j < i + n; j++)
+                    pixel[j] = v;
+                continue;
+            }
+            for (int j = i; j < i + n; j++, used += 2)
+                pixel[j] = anim_get16(in + used);
+        }
+        return used;
+    }
+    return -1;
+}
+
+//start a stream on out, the first frame is coded against black
+static inline int anim_writer_start(struct anim_writer_t *w, FILE *out)
+{
+    uint8_t header[ANIM_HEADER] = {0};
+
+    w->out = out;
+    w->frames = 0;
+    w->bytes = ANIM_HEADER;
+    px_fill(w->prev, 0);
+    memcpy(header, ANIM_MAGIC, 4);
+    header[4] = ANIM_VERSION;
+    return fwrite(header, sizeof(header), 1, out) == 1 ? 0 : -1;
+}
+
+static inline int anim_write(struct anim_writer_t *w, const uint16_t *pixel, unsigned duration_ms)
+{
+    uint8_t buf[ANIM_FRAME_MAX];
+    int len = anim_encode(buf, w->prev, pixel, duration_ms);
+
+    if (fwrite(buf, len, 1, w->out) != 1)
+        return -1;
+    px_copy(w->prev, pixel);
+    w->frames++;
+    w->bytes += len;
+    return 0;
+}
+
+//top up the buffer, keeping what is still unread; returns the bytes read, 0 at EOF
+static inline ssize_t anim_fill(struct anim_reader_t *r)
+{
+    ssize_t n;
+
+    memmove(r->buf, r->buf + r->pos, r->len - r->pos);
+    r->len -= r->pos;
+    r->pos = 0;
+    do
+        n = read(r->fd, r->buf + r->len, sizeof(r->buf) - r->len);
+    while (n < 0 && errno == EINTR);
+    if (n == 0)
+        r->eof = 1;
+    if (n > 0)
+        r->len += n;
+    return n;
+}
+
+//read and check the stream header on fd
+static inline int anim_reader_open(struct anim_reader_t *r, int fd)
+{
+    int n;
+
+    r->fd = fd;
+    r->eof = 0;
+    r->pos = r->len = 0;
+    while (r->len < ANIM_HEADER)
+    {
+        n = anim_fill(r);
+        if (n < 0)
+            return -1;
+        if (n == 0)
+        {
+            //empty or short header
+            errno = EINVAL;
+            return -1;
+        }
+    }
+    if (memcmp(r->buf, ANIM_MAGIC, 4) != 0 || r->buf[4] != ANIM_VERSION)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    r->pos = ANIM_HEADER;
+    return 0;
+}
+
+//decode the next frame into pixel, which must hold the previous one; returns 1 for a
+//frame, 0 at the end of the stream, -1 on a read error or a corrupt or cut off frame
+static inline int anim_read(struct anim_reader_t *r, uint16_t *pixel, unsigned *duration_ms)
+{
+    int n;
+
+    for (;;)
+    {
+        n = anim_decode(r->buf + r->pos, r->len - r->pos, pixel, duration_ms);
+        if (n > 0)
+        {
+            r->pos += n;
+            return 1;
+        }
+        if (n < 0)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        if (r->eof)
+        {
+            if (r->pos == r->len)
+                return 0;
+            //cut off mid frame
+            errno = EINVAL;
+            return -1;
+        }
+        if (anim_fill(r) < 0)
+            return -1;
+    }
+}
+
+#endif
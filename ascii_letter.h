@@ -1,132 +1,155 @@
-#include <stdio.h>
+/*
+ *  8x8 ASCII font for the Sense HAT LED matrix.
+ *
+ *  Each glyph is packed into a single uint64_t, one byte per row with
+ *  row 0 in the most significant byte and the leftmost column in the
+ *  most significant bit of its row. Pixel i of the 64-word framebuffer
+ *  layout (i = row * 8 + col) is therefore bit (63 - i).
+ *
+ *  The atlas only stores shape; color is applied when a glyph is blitted.
+ */
+#ifndef ASCII_LETTER_H
+#define ASCII_LETTER_H
+
 #include <stdint.h>
 
-uint16_t N = 0xFFFF;
-uint16_t ascii_letter[128][64] = {{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, N, N, 0, N, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, N, N, N, N, N, N, N, N, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, 0, 0, N, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0},
-                                  {0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, N, N, N, N, N, 0, N, 0, 0, 0, N, N, 0, 0, 0, 0, N, 0, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, 0, N, N, 0, 0, N, 0, 0, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, N, N, N, N, N, 0, N, 0, 0, 0, N, N, 0, 0, 0, 0, N, 0, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, 0, 0, N, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, 0, 0, 0, N, N, 0, N, N, N, 0, N, N, N, 0, N, N, N, N, N, N, N, 0, N, N, N, N, N, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, N, N, N, 0, 0, N, 0, N, N, 0, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, N, N, N, N, N, 0, N, N, N, 0, N, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, N, N, N, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, 0, 0, 0, N, N, 0, 0, 0, 0, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, N, N},
-                                  {0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N},
-                                  {0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0},
-                                  {0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, N, N, N, N, 0, N, N, N, N, N, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, N, N, N, N, N, 0, N, N, N, N, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, N, N, 0, N, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                                  {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
+#define GLYPH(r0, r1, r2, r3, r4, r5, r6, r7)                       \
+    (((uint64_t)(r0) << 56) | ((uint64_t)(r1) << 48) |              \
+     ((uint64_t)(r2) << 40) | ((uint64_t)(r3) << 32) |              \
+     ((uint64_t)(r4) << 24) | ((uint64_t)(r5) << 16) |              \
+     ((uint64_t)(r6) << 8) | (uint64_t)(r7))
+
+#define GLYPH_PIXEL(g, i) (((g) >> (63 - (i))) & 1)
+
+static const uint64_t ascii_letter[128] = {
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x00 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x01 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x02 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x03 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x04 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x05 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x06 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x07 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x08 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x09 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x0A */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x0B */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x0C */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x0D */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x0E */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x0F */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x10 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x11 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x12 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x13 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x14 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x15 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x16 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x17 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x18 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x19 */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x1A */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x1B */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x1C */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x1D */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x1E */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* 0x1F */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* ' ' */
+    GLYPH(0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00), /* '!' */
+    GLYPH(0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* '"' */
+    GLYPH(0x6C, 0x6C, 0xFE, 0x6C, 0xFE, 0x6C, 0x6C, 0x00), /* '#' */
+    GLYPH(0x30, 0x7C, 0xC0, 0x78, 0x0C, 0xF8, 0x30, 0x00), /* '$' */
+    GLYPH(0x00, 0xC6, 0xCC, 0x18, 0x30, 0x66, 0xC6, 0x00), /* '%' */
+    GLYPH(0x38, 0x6C, 0x38, 0x76, 0xDC, 0xCC, 0x76, 0x00), /* '&' */
+    GLYPH(0x60, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00), /* '\'' */
+    GLYPH(0x18, 0x30, 0x60, 0x60, 0x60, 0x30, 0x18, 0x00), /* '(' */
+    GLYPH(0x60, 0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00), /* ')' */
+    GLYPH(0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00), /* '*' */
+    GLYPH(0x00, 0x30, 0x30, 0xFC, 0x30, 0x30, 0x00, 0x00), /* '+' */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x60), /* ',' */
+    GLYPH(0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00), /* '-' */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00), /* '.' */
+    GLYPH(0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00), /* '/' */
+    GLYPH(0x7C, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0x7C, 0x00), /* '0' */
+    GLYPH(0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0xFC, 0x00), /* '1' */
+    GLYPH(0x78, 0xCC, 0x0C, 0x38, 0x60, 0xCC, 0xFC, 0x00), /* '2' */
+    GLYPH(0x78, 0xCC, 0x0C, 0x38, 0x0C, 0xCC, 0x78, 0x00), /* '3' */
+    GLYPH(0x1C, 0x3C, 0x6C, 0xCC, 0xFE, 0x0C, 0x1E, 0x00), /* '4' */
+    GLYPH(0xFC, 0xC0, 0xF8, 0x0C, 0x0C, 0xCC, 0x78, 0x00), /* '5' */
+    GLYPH(0x38, 0x60, 0xC0, 0xF8, 0xCC, 0xCC, 0x78, 0x00), /* '6' */
+    GLYPH(0xFC, 0xCC, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00), /* '7' */
+    GLYPH(0x78, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0x78, 0x00), /* '8' */
+    GLYPH(0x78, 0xCC, 0xCC, 0x7C, 0x0C, 0x18, 0x70, 0x00), /* '9' */
+    GLYPH(0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00), /* ':' */
+    GLYPH(0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x60), /* ';' */
+    GLYPH(0x18, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x00), /* '<' */
+    GLYPH(0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00), /* '=' */
+    GLYPH(0x60, 0x30, 0x18, 0x0C, 0x18, 0x30, 0x60, 0x00), /* '>' */
+    GLYPH(0x78, 0xCC, 0x0C, 0x18, 0x30, 0x00, 0x30, 0x00), /* '?' */
+    GLYPH(0x7C, 0xC6, 0xDE, 0xDE, 0xDE, 0xC0, 0x78, 0x00), /* '@' */
+    GLYPH(0x30, 0x78, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0x00), /* 'A' */
+    GLYPH(0xFC, 0x66, 0x66, 0x7C, 0x66, 0x66, 0xFC, 0x00), /* 'B' */
+    GLYPH(0x3C, 0x66, 0xC0, 0xC0, 0xC0, 0x66, 0x3C, 0x00), /* 'C' */
+    GLYPH(0xF8, 0x6C, 0x66, 0x66, 0x66, 0x6C, 0xF8, 0x00), /* 'D' */
+    GLYPH(0xFE, 0x62, 0x68, 0x78, 0x68, 0x62, 0xFE, 0x00), /* 'E' */
+    GLYPH(0xFE, 0x62, 0x68, 0x78, 0x68, 0x60, 0xF0, 0x00), /* 'F' */
+    GLYPH(0x3C, 0x66, 0xC0, 0xC0, 0xCE, 0x66, 0x3E, 0x00), /* 'G' */
+    GLYPH(0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0xCC, 0x00), /* 'H' */
+    GLYPH(0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00), /* 'I' */
+    GLYPH(0x1E, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0x78, 0x00), /* 'J' */
+    GLYPH(0xE6, 0x66, 0x6C, 0x78, 0x6C, 0x66, 0xE6, 0x00), /* 'K' */
+    GLYPH(0xF0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xFE, 0x00), /* 'L' */
+    GLYPH(0xC6, 0xEE, 0xFE, 0xFE, 0xD6, 0xC6, 0xC6, 0x00), /* 'M' */
+    GLYPH(0xC6, 0xE6, 0xF6, 0xDE, 0xCE, 0xC6, 0xC6, 0x00), /* 'N' */
+    GLYPH(0x38, 0x6C, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x00), /* 'O' */
+    GLYPH(0xFC, 0x66, 0x66, 0x7C, 0x60, 0x60, 0xF0, 0x00), /* 'P' */
+    GLYPH(0x78, 0xCC, 0xCC, 0xCC, 0xDC, 0x78, 0x1C, 0x00), /* 'Q' */
+    GLYPH(0xFC, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0xE6, 0x00), /* 'R' */
+    GLYPH(0x78, 0xCC, 0xE0, 0x70, 0x1C, 0xCC, 0x78, 0x00), /* 'S' */
+    GLYPH(0xFC, 0xB4, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00), /* 'T' */
+    GLYPH(0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0x00), /* 'U' */
+    GLYPH(0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x00), /* 'V' */
+    GLYPH(0xC6, 0xC6, 0xC6, 0xD6, 0xFE, 0xEE, 0xC6, 0x00), /* 'W' */
+    GLYPH(0xC6, 0xC6, 0x6C, 0x38, 0x38, 0x6C, 0xC6, 0x00), /* 'X' */
+    GLYPH(0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x30, 0x78, 0x00), /* 'Y' */
+    GLYPH(0xFE, 0xC6, 0x8C, 0x18, 0x32, 0x66, 0xFE, 0x00), /* 'Z' */
+    GLYPH(0x78, 0x60, 0x60, 0x60, 0x60, 0x60, 0x78, 0x00), /* '[' */
+    GLYPH(0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x00), /* '\\' */
+    GLYPH(0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00), /* ']' */
+    GLYPH(0x10, 0x38, 0x6C, 0xC6, 0x00, 0x00, 0x00, 0x00), /* '^' */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF), /* '_' */
+    GLYPH(0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00), /* '`' */
+    GLYPH(0x00, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0x76, 0x00), /* 'a' */
+    GLYPH(0xE0, 0x60, 0x60, 0x7C, 0x66, 0x66, 0xDC, 0x00), /* 'b' */
+    GLYPH(0x00, 0x00, 0x78, 0xCC, 0xC0, 0xCC, 0x78, 0x00), /* 'c' */
+    GLYPH(0x1C, 0x0C, 0x0C, 0x7C, 0xCC, 0xCC, 0x76, 0x00), /* 'd' */
+    GLYPH(0x00, 0x00, 0x78, 0xCC, 0xFC, 0xC0, 0x78, 0x00), /* 'e' */
+    GLYPH(0x38, 0x6C, 0x60, 0xF0, 0x60, 0x60, 0xF0, 0x00), /* 'f' */
+    GLYPH(0x00, 0x00, 0x76, 0xCC, 0xCC, 0x7C, 0x0C, 0xF8), /* 'g' */
+    GLYPH(0xE0, 0x60, 0x6C, 0x76, 0x66, 0x66, 0xE6, 0x00), /* 'h' */
+    GLYPH(0x30, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00), /* 'i' */
+    GLYPH(0x0C, 0x00, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0x78), /* 'j' */
+    GLYPH(0xE0, 0x60, 0x66, 0x6C, 0x78, 0x6C, 0xE6, 0x00), /* 'k' */
+    GLYPH(0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00), /* 'l' */
+    GLYPH(0x00, 0x00, 0xCC, 0xFE, 0xFE, 0xD6, 0xC6, 0x00), /* 'm' */
+    GLYPH(0x00, 0x00, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0x00), /* 'n' */
+    GLYPH(0x00, 0x00, 0x78, 0xCC, 0xCC, 0xCC, 0x78, 0x00), /* 'o' */
+    GLYPH(0x00, 0x00, 0xDC, 0x66, 0x66, 0x7C, 0x60, 0xF0), /* 'p' */
+    GLYPH(0x00, 0x00, 0x76, 0xCC, 0xCC, 0x7C, 0x0C, 0x1E), /* 'q' */
+    GLYPH(0x00, 0x00, 0xDC, 0x76, 0x66, 0x60, 0xF0, 0x00), /* 'r' */
+    GLYPH(0x00, 0x00, 0x7C, 0xC0, 0x78, 0x0C, 0xF8, 0x00), /* 's' */
+    GLYPH(0x10, 0x30, 0x7C, 0x30, 0x30, 0x34, 0x18, 0x00), /* 't' */
+    GLYPH(0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00), /* 'u' */
+    GLYPH(0x00, 0x00, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x00), /* 'v' */
+    GLYPH(0x00, 0x00, 0xC6, 0xD6, 0xFE, 0xFE, 0x6C, 0x00), /* 'w' */
+    GLYPH(0x00, 0x00, 0xC6, 0x6C, 0x38, 0x6C, 0xC6, 0x00), /* 'x' */
+    GLYPH(0x00, 0x00, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0xF8), /* 'y' */
+    GLYPH(0x00, 0x00, 0xFC, 0x98, 0x30, 0x64, 0xFC, 0x00), /* 'z' */
+    GLYPH(0x1C, 0x30, 0x30, 0xE0, 0x30, 0x30, 0x1C, 0x00), /* '{' */
+    GLYPH(0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00), /* '|' */
+    GLYPH(0xE0, 0x30, 0x30, 0x1C, 0x30, 0x30, 0xE0, 0x00), /* '}' */
+    GLYPH(0x76, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), /* '~' */
+    GLYPH(0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)  /* 0x7F */
+};
+
+#endif
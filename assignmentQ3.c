@@ -1,801 +1,1251 @@
-/*
- *  C code to demonstrate control of the LED matrix for the
- *  Raspberry Pi Sense HAT add-on board.
- *
- *  Uses the mmap method to map the led device into memory
- *
- *  Build with:  gcc -Wall -O2 led_matrix.c -o led_matrix
- *
- *  Tested with:  Raspbian GNU/Linux 10 (buster) / Raspberry Pi 4 model B
- *
- */
-#define _GNU_SOURCE
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <sys/types.h>
-#include <sys/stat.h>
-#include <unistd.h>
-#include <fcntl.h>
-#include <dirent.h>
-#include <stdint.h>
-#include <string.h>
-#include <time.h>
-
-#include <sys/ioctl.h>
-#include <poll.h>
-#include <sys/mman.h>
-#include <linux/fb.h>
-#include <linux/input.h>
-
-#define DEV_INPUT_EVENT "/dev/input"
-#define EVENT_DEV_NAME "event"
-#define DEV_FB "/dev"
-#define FB_DEV_NAME "fb"
-
-#define NUM_WORDS 64
-#define FILESIZE (NUM_WORDS * sizeof(uint16_t))
-
-#define R 0xF800
-#define G 0x07E0
-#define B 0x001F
-#define W 0xFFFF
-#define Y 0xFFE0
-#define BK 0x0000
-
-#define BOLDBLACK "\033[1m\033[30m" //bold black printing color
-#define BOLDGREEN "\033[1m\033[32m" //bold green printing color
-#define BOLDRED "\033[1m\033[31m"   //bold red printing color
-#define BOLDBLUE "\033[1m\033[34m"  //bold blue printing color
-#define BOLDYELLOW "\033[1m\033[33m"  //bold blue printing color
-#define RESET "\033[0m"             //reset printing color
-
-void delay(int);
-void colorSet(int choice, uint16_t *n);
-void editMatrix(uint16_t *ptr, uint16_t *N, uint16_t user_matrix[64], uint16_t *map);
-void setColor(uint16_t N, uint16_t (*letter_ptr)[64]);
-void selectColor(uint16_t *ptr, uint16_t *N, uint16_t letter[][64], uint16_t *map);
-void displayText(uint16_t *p, uint16_t letter[128][64], char message[100], char ch);
-int gameSnake(int fbfd, uint16_t N);
-void render(uint16_t N);
-int check_collision(int appleCheck);
-void game_logic(void);
-void reset(void);
-void change_dir(unsigned int code);
-void handle_events(int evfd);
-
-enum direction_t
-{
-    UP,
-    RIGHT,
-    DOWN,
-    LEFT,
-    NONE,
-};
-struct segment_t
-{
-    struct segment_t *next;
-    int x;
-    int y;
-};
-struct snake_t
-{
-    struct segment_t head;
-    struct segment_t *tail;
-    enum direction_t heading;
-};
-struct apple_t
-{
-    int x;
-    int y;
-};
-
-struct fb_t
-{
-    uint16_t pixel[8][8];
-};
-
-int running = 1;
-
-struct snake_t snake = {
-    {NULL, 4, 4},
-    NULL,
-    NONE,
-};
-struct apple_t apple = {
-    4,
-    4,
-};
-struct pollfd evpoll = {
-    .events = POLLIN,
-};
-
-struct fb_t *fb;
-
-static int is_event_device(const struct dirent *dir)
-{
-    return strncmp(EVENT_DEV_NAME, dir->d_name,
-                   strlen(EVENT_DEV_NAME) - 1) == 0;
-}
-static int is_framebuffer_device(const struct dirent *dir)
-{
-    return strncmp(FB_DEV_NAME, dir->d_name,
-                   strlen(FB_DEV_NAME) - 1) == 0;
-}
-
-static int open_evdev(const char *dev_name)
-{
-    struct dirent **namelist;
-    int i, ndev;
-    int fd = -1;
-
-    ndev = scandir(DEV_INPUT_EVENT, &namelist, is_event_device, versionsort);
-    if (ndev <= 0)
-        return ndev;
-
-    for (i = 0; i < ndev; i++)
-    {
-        char fname[64];
-        char name[256];
-
-        snprintf(fname, sizeof(fname),
-                 "%s/%s", DEV_INPUT_EVENT, namelist[i]->d_name);
-        fd = open(fname, O_RDONLY);
-        if (fd < 0)
-            continue;
-        ioctl(fd, EVIOCGNAME(sizeof(name)), name);
-        if (strcmp(dev_name, name) == 0)
-            break;
-        close(fd);
-    }
-
-    for (i = 0; i < ndev; i++)
-        free(namelist[i]);
-
-    return fd;
-}
-
-static int open_fbdev(const char *dev_name)
-{
-    struct dirent **namelist;
-    int i, ndev;
-    int fd = -1;
-    struct fb_fix_screeninfo fix_info;
-
-    ndev = scandir(DEV_FB, &namelist, is_framebuffer_device, versionsort);
-    if (ndev <= 0)
-        return ndev;
-
-    for (i = 0; i < ndev; i++)
-    {
-        char fname[64];
-        char name[256];
-
-        snprintf(fname, sizeof(fname),
-                 "%s/%s", DEV_FB, namelist[i]->d_name);
-        fd = open(fname, O_RDWR);
-        if (fd < 0)
-            continue;
-        ioctl(fd, FBIOGET_FSCREENINFO, &fix_info);
-        if (strcmp(dev_name, fix_info.id) == 0)
-            break;
-        close(fd);
-        fd = -1;
-    }
-    for (i = 0; i < ndev; i++)
-        free(namelist[i]);
-
-    return fd;
-}
-
-int main(void)
-{
-    char message[100] = {}, ch;
-    int i, choice;
-    //int fbfd;
-    uint16_t *map;
-    uint16_t *p;
-    uint16_t N = W;
-    uint16_t user_matrix[64] = {};
-    uint16_t letter[128][64] = {{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, N, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, N, N, N, N, N, N, N, N, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, N, 0, 0, N, N, 0, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, 0, N, 0, 0, 0, 0, N, N, 0, 0, 0, N, 0, N, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, N, 0, 0, N, N, 0, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, 0, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, 0, N, N, 0, N, N, N, 0, N, N, N, 0, N, N, N, N, N, N, N, 0, N, N, N, N, N, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, N, N, N, N, 0, N, N, 0, N, N, 0, N, N, N, N, 0, N, N, 0, 0, N, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, 0, 0, N, 0, N, N, 0, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, N, N, N, N, N, 0, N, N, N, 0, N, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, N, N, N, N, 0, N, N, 0, 0, 0, N, N, 0, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, N, N},
-                               {0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0},
-                               {N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0},
-                               {N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, N, N, 0, N, N, N, N, N, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, N, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, N, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, N, N, 0, N, 0, N, N, 0, N, N, N, N, N, N, N, 0, N, N, N, N, N, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, N, N, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, N, N, 0, 0, 0, N, N, N, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, N, N, N, N, N, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, N, N, N, N, 0, 0, N, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, N, N, 0, 0, N, 0, 0, N, N, N, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {N, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, N, N, 0, 0, 0, 0, 0, 0, N, N, 0, 0, 0, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, N, N, N, 0, N, N, 0, N, N, 0, N, N, N, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-                               {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}};
-    int ret = 0;
-    int fbfd = 0;
-
-    srand(time(NULL));
-
-    evpoll.fd = open_evdev("Raspberry Pi Sense HAT Joystick");
-    if (evpoll.fd < 0)
-    {
-        fprintf(stderr, "Event device not found.\n");
-        return evpoll.fd;
-    }
-
-    fbfd = open_fbdev("RPi-Sense FB");
-    if (fbfd <= 0)
-    {
-        ret = fbfd;
-        printf("Error: cannot open framebuffer device.\n");
-        close(evpoll.fd);
-    }
-
-    fb = mmap(0, 128, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
-    if (!fb)
-    {
-        ret = EXIT_FAILURE;
-        printf("Failed to mmap.\n");
-        close(fbfd);
-    }
-
-    /* map the led frame buffer device into memory */
-    map = mmap(NULL, FILESIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
-    if (map == MAP_FAILED)
-    {
-        close(fbfd);
-        perror("Error mmapping the file");
-        exit(EXIT_FAILURE);
-    }
-
-    /* set a pointer to the start of the memory area */
-    p = map;
-
-    /* clear the led matrix */
-    memset(map, 0, FILESIZE);
-    //MAIN MENU, TO BE BRANCHED TO SUB MENUS, ETC
-    while (choice != 0)
-    {
-        printf("%sMAIN MENU%s\n1. Change Color\n2. Edit Matrix\n3. Display Message\n4. Test Game\n0. Exit\nEnter Selection:", BOLDBLACK, RESET);
-        scanf("%d", &choice);
-        switch (choice)
-        {
-        case 0:
-            break;
-
-        case 1:
-            selectColor(p, &N, letter, map);    //calls the change color function
-            break;
-        case 2:
-            editMatrix(p, &N, user_matrix, map);    //calls the edit matrix function
-            break;
-        case 3:
-            displayText(p, letter, message, ch);    //calls the display message function
-            break;
-        case 4:
-            gameSnake(fbfd, N);                    //calls the test game function
-            break;
-        }
-    }
-
-    /* clear the led matrix */
-    memset(map, 0, FILESIZE);
-
-    /* un-map and close */
-    if (munmap(map, FILESIZE) == -1)
-    {
-        perror("Error un-mmapping the file");
-    }
-    close(fbfd);
-    close(evpoll.fd);
-    return 0;
-}
-
-void delay(int t)
-{
-    usleep(t * 1000);
-}
-
-void editMatrix(uint16_t *ptr, uint16_t *N, uint16_t user_matrix[64], uint16_t *map)
-
-{
-    int i, j, k, row, col, edit, choice;
-    char temp[500], value[10], delim[2] = ",";  //delimiters, temporary string storages
-    char *token;
-    FILE *save_ptr;
-    save_ptr = fopen("saved.txt", "r");
-    if (save_ptr == NULL)               //error checking for file not found
-    {
-        save_ptr = fopen("saved.txt", "w");         //creates a new save file if file not found
-        printf("saved file not found, creating a new save\n");
-    }
-    fgets(temp, 300, save_ptr);                 //get the first line of the save file
-    token = strtok(temp, delim);                //split the string file into user_matrix[] array values
-    i = 0;
-    while (token != NULL)
-    {
-        user_matrix[i] = atoi(token);           //split the line of string delimited by ',', and assign each element into the nodes of the LED Matrix
-        token = strtok(NULL, delim);
-        i++;
-    }
-    if (i != 64)                                //check if the data in the save file fully maps to the 8x8 LED Matrix
-    {
-        printf("Corrupted save, creating new save\n");
-        for (j = 0; j < NUM_WORDS; j++)
-        {
-            user_matrix[j] = 0;                 //initialize a new matrix if the save file is corrupted
-        }
-    }
-    fclose(save_ptr);                           //close the file pointer
-    save_ptr = fopen("saved.txt", "w");         //open a new file pointer for writing
-    i = 0;
-    k = 0;
-    choice = 0;
-    printf("Matrix customizer\nEnter 0 at anytime to quit and return to main menu\nPress 1 to Continue...\n");
-    scanf("%d", &choice);
-    while (choice != 0)
-    {
-        printf("USER MATRIX\n");
-        for (i = 0; i < NUM_WORDS; i++)         //displays the current matrix setup
-        {
-            *(ptr + i) = user_matrix[i];
-        }
-        for (i = 0, k = 0; i < 8; i++)
-        {
-            for (j = 0; j < 8; j++, k++)
-            {
-                user_matrix[k] != 0 ? printf("1 ") : printf("0 ");  //prints out a 8x8 layout of the current configuration
-            }
-            printf("\n");
-        }
-        printf("Enter row (1 - 8):");           //prompts user for row input
-        scanf("%d", &row);
-        if (row == 0)
-            break;
-        printf("Enter col (1 - 8):");           //prompts user for column input
-        scanf("%d", &col);
-        if (col == 0)
-            break;
-        if (row <= 0 || col <= 0 || row > 8 || col > 8)
-        {
-            printf("Enter positive values(1 - 8) for rows and columns\n");  //prompt user for input if out of range values are entered
-        }
-        else
-        {
-            edit = (row - 1) * 8 + col - 1;
-            user_matrix[edit] = user_matrix[edit] == 0 ? *N : 0;        //set the respective node with the current color
-        }
-    }
-    for (i = 0; i < NUM_WORDS; i++)         //write the matrix into the save file
-    {
-        sprintf(value, "%u", user_matrix[i]);
-        fputs(value, save_ptr);
-        if (i != NUM_WORDS - 1)
-        {
-            fputs(delim, save_ptr);
-        }
-    }
-    fclose(save_ptr);
-    memset(map, 0, FILESIZE);           //reset the framebuffer before return to main menu
-}
-
-void colorSet(int choice, uint16_t *n)  //function to set the current color of the LED.
-{
-    if (choice == 1)
-    {
-        *n = R;
-    }
-    else if (choice == 2)
-    {
-        *n = G;
-    }
-    else if (choice == 3)
-    {
-        *n = B;
-    }
-    else if (choice == 4)
-    {
-        *n = Y;
-    }
-    else if (choice == 5)
-    {
-        *n = W;
-    }
-    else
-    {
-    }
-}
-
-//set color choosen
-void setColor(uint16_t N, uint16_t (*letter_ptr)[64])   //apply the current color to change all ascii characters
-{
-    for (int i = 0; i < 128; i++)
-    {
-        for (int k = 0; k < 64; k++)
-        {
-            if (letter_ptr[i][k] != 0)
-            {
-                letter_ptr[i][k] = N;
-            }
-        }
-    }
-}
-
-//select color choosen
-void selectColor(uint16_t *ptr, uint16_t *N, uint16_t letter[][64], uint16_t *map)
-{
-    int i, choice = 1;
-    printf("COLOR SETTER\n 0. Exit\n %s1. Red\n %s2. Green\n %s3. Blue\n %s4. Yellow\n %s5. White\n", BOLDRED, BOLDGREEN, BOLDBLUE, BOLDYELLOW, RESET);
-    while (choice != 0)
-    {
-        printf("Select color:");
-        scanf("%d", &choice);
-        colorSet(choice, N);
-        setColor(*N, letter);
-    }
-    printf("Color changed to:0x%04X\n", *N);
-    memset(map, 0, FILESIZE);
-}
-
-//display message typed in with sliding animation
-void displayText(uint16_t *p, uint16_t letter[128][64], char message[100], char ch)
-{
-    int option = 1;
-    printf("Display Message\nPress 0. Exit\n");
-    fgetc(stdin);
-    while (option != 0)
-    {
-        //clear array
-        memset(message, 0, 100);
-        printf("\nEnter alphabetic message: ");
-        fgets(message, 100, stdin);
-        if (strlen(message) != 1)
-        {
-            if (message[0] == 48)
-            {
-                option = 0;
-            }
-            else
-            {
-                //length message input
-                int lengthOfMessage = strlen(message) - 1;
-                //length of array that will be used
-                int arr_length = lengthOfMessage * 8;
-                uint16_t Choosenletter[8][1000] = {};
-                int count = 0;
-                uint16_t zero = 0;
-                //loop each char in message input
-                for (int i = 0; i < lengthOfMessage; i++)
-                {
-                    count = 0;
-                    //get letter value to access letter[], where the pixels of each letter is stored
-                    int letterValue = message[i] ;
-                    int spacing = i * 8;
-                    //to set the array of each row of display
-                    //compile letters together
-                    for (int k = 0; k < 64; k += 8)
-                    {
-                        for (int j = 0; j < 8; j++)
-                        {
-                            Choosenletter[count][j + spacing] = letter[letterValue][j + k];
-                        }
-                        count++;
-                    }
-                }
-                int number = 0;
-                //sliding animation
-                for (int m = 0; m < arr_length; m++)
-                {
-                    count = 0;
-                    //each loop moves "right" by 1, causes the sliding animation
-                    for (int k = 0; k < 8; k++)
-                    {
-                        for (int l = 0; l < 8; l++)
-                        {
-                            *(p + count + l) = Choosenletter[k][l + m];
-                        }
-                        count += 8;
-                    }
-                    number++;
-                    delay(100);
-                    memset(p, 0, FILESIZE);
-                }
-            }
-        }
-    }
-}
-
-int gameSnake(int fbfd, uint16_t N)
-{
-
-    memset(fb, 0, 128);
-    snake.tail = &snake.head;
-    reset();
-    while (running)
-    {
-        while (poll(&evpoll, 1, 0) > 0)
-            handle_events(evpoll.fd);
-        game_logic();
-        if (check_collision(0))
-        {
-            reset();
-        }
-        render(N);
-        usleep(300000);
-    }
-    memset(fb, 0, 128);
-    reset();
-    munmap(fb, 128);
-}
-
-void render(uint16_t N)
-{
-    struct segment_t *seg_i;
-    memset(fb, 0, 128);
-    fb->pixel[apple.x][apple.y] = 0xF800;
-    for (seg_i = snake.tail; seg_i->next; seg_i = seg_i->next)
-    {
-        fb->pixel[seg_i->x][seg_i->y] = N;
-    }
-    fb->pixel[seg_i->x][seg_i->y] = 0xFFFF;
-}
-
-int check_collision(int appleCheck)
-{
-    struct segment_t *seg_i;
-
-    if (appleCheck)
-    {
-        for (seg_i = snake.tail; seg_i; seg_i = seg_i->next)
-        {
-            if (seg_i->x == apple.x && seg_i->y == apple.y)
-                return 1;
-        }
-        return 0;
-    }
-
-    for (seg_i = snake.tail; seg_i->next; seg_i = seg_i->next)
-    {
-        if (snake.head.x == seg_i->x && snake.head.y == seg_i->y)
-            return 1;
-    }
-
-    if (snake.head.x < 0 || snake.head.x > 7 ||
-        snake.head.y < 0 || snake.head.y > 7)
-    {
-        return 1;
-    }
-    return 0;
-}
-
-void game_logic(void)
-{
-    struct segment_t *seg_i;
-    struct segment_t *new_tail;
-    for (seg_i = snake.tail; seg_i->next; seg_i = seg_i->next)
-    {
-        seg_i->x = seg_i->next->x;
-        seg_i->y = seg_i->next->y;
-    }
-    if (check_collision(1))
-    {
-        new_tail = malloc(sizeof(struct segment_t));
-        if (!new_tail)
-        {
-            printf("Ran out of memory.\n");
-            running = 0;
-            return;
-        }
-        new_tail->x = snake.tail->x;
-        new_tail->y = snake.tail->y;
-        new_tail->next = snake.tail;
-        snake.tail = new_tail;
-
-        while (check_collision(1))
-        {
-            apple.x = rand() % 8;
-            apple.y = rand() % 8;
-        }
-    }
-    switch (snake.heading)
-    {
-    case LEFT:
-        seg_i->y--;
-        break;
-    case DOWN:
-        seg_i->x++;
-        break;
-    case RIGHT:
-        seg_i->y++;
-        break;
-    case UP:
-        seg_i->x--;
-        break;
-    }
-}
-
-void reset(void)
-{
-    struct segment_t *seg_i;
-    struct segment_t *next_tail;
-    seg_i = snake.tail;
-    while (seg_i->next)
-    {
-        next_tail = seg_i->next;
-        free(seg_i);
-        seg_i = next_tail;
-    }
-    snake.tail = seg_i;
-    snake.tail->next = NULL;
-    snake.tail->x = 2;
-    snake.tail->y = 3;
-    apple.x = rand() % 8;
-    apple.y = rand() % 8;
-    snake.heading = NONE;
-}
-
-void change_dir(unsigned int code)
-{
-    switch (code)
-    {
-    case KEY_UP:
-        if (snake.heading != DOWN)
-            snake.heading = UP;
-        break;
-    case KEY_RIGHT:
-        if (snake.heading != LEFT)
-            snake.heading = RIGHT;
-        break;
-    case KEY_DOWN:
-        if (snake.heading != UP)
-            snake.heading = DOWN;
-        break;
-    case KEY_LEFT:
-        if (snake.heading != RIGHT)
-            snake.heading = LEFT;
-        break;
-    }
-}
-
-void handle_events(int evfd)
-{
-    struct input_event ev[64];
-    int i, rd;
-
-    rd = read(evfd, ev, sizeof(struct input_event) * 64);
-    if (rd < (int)sizeof(struct input_event))
-    {
-        fprintf(stderr, "expected %d bytes, got %d\n",
-                (int)sizeof(struct input_event), rd);
-        return;
-    }
-    for (i = 0; i < rd / sizeof(struct input_event); i++)
-    {
-        if (ev->type != EV_KEY)
-            continue;
-        if (ev->value != 1)
-            continue;
-        switch (ev->code)
-        {
-        case KEY_ENTER:
-            running = 0;
-            break;
-        default:
-            change_dir(ev->code);
-        }
-    }
-}
\ No newline at end of file
+/*
+ *  C code to demonstrate control of the LED matrix for the
+ *  Raspberry Pi Sense HAT add-on board.
+ *
+ *  Uses the mmap method to map the led device into memory
+ *
+ *  Build with:  gcc -Wall -O2 assignmentQ3.c -o assignmentQ3 -pthread -lm
+ *  (-lm for powf() in the gamma tables, see gamma.h)
+ *
+ *  Tested with:  Raspbian GNU/Linux 10 (buster) / Raspberry Pi 4 model B
+ *
+ */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <sys/ioctl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include <linux/fb.h>
+#include <linux/input.h>
+
+#include "ascii_letter.h"
+#include "marquee.h"
+#include "sense_hat.h"
+#include "frame.h"
+#include "snake_engine.h"
+#include "scheduler.h"
+#include "anim_clock.h"
+#include "matrix_store.h"
+#include "sprite_store.h"
+#include "anim_codec.h"
+#include "command.h"
+#include "canvas.h"
+#include "netframe.h"
+#include "frame_ring.h"
+#include "compositor.h"
+
+#define NUM_WORDS 64
+#define FILESIZE (NUM_WORDS * sizeof(uint16_t))
+
+#define R 0xF800
+#define G 0x07E0
+#define B 0x001F
+#define W 0xFFFF
+#define Y 0xFFE0
+#define BK 0x0000
+
+#define BOLDBLACK "\033[1m\033[30m" //bold black printing color
+#define BOLDGREEN "\033[1m\033[32m" //bold green printing color
+#define BOLDRED "\033[1m\033[31m"   //bold red printing color
+#define BOLDBLUE "\033[1m\033[34m"  //bold blue printing color
+#define BOLDYELLOW "\033[1m\033[33m"  //bold blue printing color
+#define RESET "\033[0m"             //reset printing color
+
+struct ui_t;
+
+void colorSet(int choice, uint16_t *n);
+int scrollMessage(struct canvas_t *canvas, const uint16_t *pal, int first, FILE *in);
+long playAnimation(struct canvas_t *canvas, struct anim_reader_t *r);
+void render(struct compositor_t *comp, const struct snake_game_t *g);
+int uiInit(struct ui_t *ui, struct canvas_t *canvas);
+void uiRun(struct ui_t *ui);
+void uiClose(struct ui_t *ui);
+
+//palette slots, every draw path looks its colors up here at blit time
+enum palette_index
+{
+    PAL_BG,
+    PAL_FG,
+    PAL_APPLE,
+    PAL_HEAD,
+    PAL_SCORE,
+    PAL_SIZE,
+};
+
+uint16_t palette[PAL_SIZE] = {BK, W, R, W, Y};
+
+struct snake_speed_t speed = SNAKE_SPEED_DEFAULT;
+
+unsigned scroll_fps = 10; //marquee columns per second
+
+struct pollfd evpoll = {
+    .events = POLLIN,
+};
+
+struct canvas_t canvas; //every panel of the wall, a single one by default
+
+struct gamma_t correction; //brightness and gamma, the canvas only uses it when it changes anything
+
+struct anim_writer_t *recorder; //when set, every scrolled frame is also written here
+
+//what the display loop is animating
+enum ui_mode
+{
+    MODE_IDLE,
+    MODE_TEXT,
+    MODE_SNAKE,
+    MODE_SPRITE,
+    MODE_RING,
+};
+
+#define UI_COMMAND SCHED_USER //a command line is ready on stdin
+#define UI_TICKER (SCHED_USER << 1) //the notification ticker's timer expired
+#define UI_REFRESH (SCHED_USER << 2) //time to present the wall again, to dither or fade
+#define REFRESH_HZ 100
+#define RING_FPS 50           //compositor ticks a second while showing the frame ring
+#define SCORE_OPACITY 160     //the snake shows through the score
+
+//compositor layers from the bottom up, added in this order so the id is the index
+enum ui_layer
+{
+    LAYER_MATRIX, //the user drawing, shown while idle
+    LAYER_MODE,   //snake board, sprite or ring frame
+    LAYER_SCORE,  //apples eaten in binary over the first row of the board
+    LAYER_TICKER, //notifications scrolling over everything
+};
+
+//state of the command driven display loop, the menus of old each became a command
+struct ui_t
+{
+    struct canvas_t *canvas;
+    struct sched_t sched;
+    struct cmd_reader_t cmds;
+    struct input_thread_t input;
+    const struct cmd_t *commands;
+    int joystick;  //input thread running
+    int pollable;  //stdin can go in the epoll set, a plain file cannot and is always ready
+    int watching;  //stdin is in the epoll set
+    int readable;  //epoll reported stdin ready and it has not been read since
+    int eof;       //no more commands will come
+    int prompt;    //stdin is a terminal
+    int running;
+    int waiting;   //a wait command holds further commands until the animation ends
+    enum ui_mode mode;
+    unsigned long ticks, missed; //scheduler counts when the mode started
+
+    uint16_t user_matrix[64];
+    struct matrix_store_t store;
+    int saved;     //matrix_store_open() result, changes are only kept when >= 0
+    int dirty;
+
+    struct canvas_marquee_t marquee;
+    char text[CMD_LINE_MAX];
+    size_t text_pos;
+    int hungry, done;
+
+    struct snake_game_t game;
+
+    struct sprite_store_t sprites;
+    int sprites_open;
+    struct sprite_player_t player;
+    long sprite_ns; //timer period of the sprite frame on screen
+
+    struct frame_ring_t ring; //frames other processes submit
+    int ring_open;
+
+    //the 8x8 modes draw into layers, the wall-wide text mode draws on the canvas itself
+    struct compositor_t comp;
+    struct marquee_t ticker;
+    char ticker_text[CMD_LINE_MAX];
+    size_t ticker_pos;
+    int ticker_fd, ticker_on, ticker_hungry, ticker_done;
+
+    int refresh_fd, refreshing;
+    unsigned fade_from, fade_to;       //brightness levels
+    unsigned long fade_step, fade_steps; //refreshes into the fade and in it
+};
+
+int main(int argc, char *argv[])
+{
+    int i, c, interactive = 1;
+    //int fbfd;
+    uint16_t *map;
+    int ret = 0;
+    int fbfd = 0;
+    int opt;
+    const char *play = NULL, *record = NULL, *net = NULL;
+    struct netframe_sender_t sender;
+    struct anim_writer_t writer;
+    struct ui_t ui;
+    int cols = 1, rows = 1;
+
+    while ((opt = getopt(argc, argv, "f:p:w:W:N:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'f':
+            scroll_fps = strtoul(optarg, NULL, 10);
+            break;
+        case 'p':
+            play = optarg;
+            break;
+        case 'w':
+            record = optarg;
+            break;
+        case 'W':
+            if (sscanf(optarg, "%dx%d", &cols, &rows) != 2 || cols < 1 || rows < 1)
+                cols = 0;
+            break;
+        case 'N':
+            net = optarg;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-f scroll_fps] [-p animation] [-w animation] [-W colsxrows] [-N udp:host:port|unix:path] [message_stream]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (scroll_fps == 0)
+    {
+        fprintf(stderr, "scroll rate must be positive\n");
+        return EXIT_FAILURE;
+    }
+    if (cols == 0)
+    {
+        fprintf(stderr, "wall size must be given as colsxrows panels, e.g. 4x1\n");
+        return EXIT_FAILURE;
+    }
+    //animations are recorded in 8x8 frames
+    if (record != NULL && cols * rows != 1)
+    {
+        fprintf(stderr, "-w needs a single panel\n");
+        return EXIT_FAILURE;
+    }
+
+    //a wall or -N gives the output somewhere else, the joystick is optional everywhere
+    evpoll.fd = open_evdev("Raspberry Pi Sense HAT Joystick");
+    if (evpoll.fd < 0)
+        fprintf(stderr, "Event device not found, running without the joystick.\n");
+
+    map = NULL;
+    fbfd = cols * rows == 1 ? open_fbdev("RPi-Sense FB") : -1;
+    if (fbfd > 0)
+    {
+        /* map the led frame buffer device into memory */
+        map = mmap(NULL, FILESIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
+        if (map == MAP_FAILED)
+        {
+            perror("Error mmapping the file");
+            map = NULL;
+        }
+    }
+    if (cols * rows == 1 && map == NULL && net == NULL)
+    {
+        printf("Error: cannot open framebuffer device.\n");
+        if (fbfd > 0)
+            close(fbfd);
+        if (evpoll.fd >= 0)
+            close(evpoll.fd);
+        exit(EXIT_FAILURE);
+    }
+
+    /* draw on the canvas and present to the mapped devices, this also clears the led matrices */
+    if (canvas_init(&canvas, cols, rows) < 0)
+    {
+        perror("Error allocating the canvas");
+        exit(EXIT_FAILURE);
+    }
+    gamma_init(&correction, GAMMA_LEVEL_MAX, 1.0f, 0);
+    if (cols * rows == 1)
+    {
+        //without a local panel the tile is only sent to net
+        if (map != NULL)
+            canvas_attach(&canvas, 0, map);
+    }
+    else if (getenv(CANVAS_WALL_ENV) != NULL ? canvas_open_tiles(&canvas, getenv(CANVAS_WALL_ENV), 0) < 0 : net == NULL)
+    {
+        fprintf(stderr, "a wall needs " CANVAS_WALL_ENV " set to a pattern naming every panel, e.g. /dev/shm/wall%%d, or -N\n");
+        canvas_free(&canvas);
+        exit(EXIT_FAILURE);
+    }
+
+    //send every tile the canvas flushes to the receivers behind net as well
+    if (net != NULL)
+    {
+        if (netframe_sender_open(&sender, net, cols * rows) < 0)
+        {
+            perror("Error opening the frame socket");
+            canvas_free(&canvas);
+            exit(EXIT_FAILURE);
+        }
+        canvas.remote = netframe_canvas_send;
+        canvas.remote_ctx = &sender;
+    }
+
+    //record the scrolled text as a delta-coded animation
+    if (record != NULL)
+    {
+        FILE *out = fopen(record, "w");
+        if (out == NULL || anim_writer_start(&writer, out) < 0)
+        {
+            perror("Error creating animation");
+            if (out != NULL)
+                fclose(out);
+        }
+        else
+        {
+            recorder = &writer;
+        }
+    }
+
+    //play an animation file or FIFO across the wall
+    if (play != NULL)
+    {
+        struct anim_reader_t reader;
+        int afd = open(play, O_RDONLY | O_CLOEXEC);
+        if (afd < 0 || anim_reader_open(&reader, afd) < 0)
+            perror("Error opening animation");
+        else if (playAnimation(&canvas, &reader) < 0)
+            perror("Error playing animation");
+        if (afd >= 0)
+            close(afd);
+        interactive = 0;
+    }
+
+    //stream a text file or FIFO straight to the display instead of showing the menu
+    if (optind < argc)
+    {
+        FILE *in = fopen(argv[optind], "r");
+        if (in == NULL)
+        {
+            perror("Error opening message stream");
+        }
+        else
+        {
+            while ((c = fgetc(in)) != EOF)
+            {
+                if (c != '\n' && scrollMessage(&canvas, palette, c, in) == EOF)
+                    break;
+            }
+            fclose(in);
+        }
+        interactive = 0;
+    }
+
+    //take commands from stdin while the display keeps animating
+    if (interactive)
+    {
+        if (uiInit(&ui, &canvas) < 0)
+        {
+            perror("Error starting the command loop");
+        }
+        else
+        {
+            uiRun(&ui);
+            uiClose(&ui);
+        }
+    }
+
+    if (recorder != NULL)
+    {
+        fprintf(stderr, "recorded %lu frames in %lu bytes\n", recorder->frames, recorder->bytes);
+        if (fclose(recorder->out) != 0)
+            perror("Error writing animation");
+    }
+
+    /* clear the led matrices */
+    if (net != NULL)
+        netframe_rekey(&sender);
+    canvas_fill(&canvas, 0);
+    canvas_flush(&canvas);
+    canvas_free(&canvas);
+    if (net != NULL)
+    {
+        fprintf(stderr, "sent %lu packets, %lu full, %lu bytes, %lu refused\n",
+                sender.packets, sender.keys, sender.bytes, sender.errors);
+        netframe_sender_close(&sender);
+    }
+
+    /* un-map and close */
+    if (map != NULL && munmap(map, FILESIZE) == -1)
+    {
+        perror("Error un-mmapping the file");
+    }
+    if (fbfd > 0)
+        close(fbfd);
+    if (evpoll.fd >= 0)
+        close(evpoll.fd);
+    return 0;
+}
+
+void colorSet(int choice, uint16_t *n)  //function to set the current color of the LED.
+{
+    if (choice == 1)
+    {
+        *n = R;
+    }
+    else if (choice == 2)
+    {
+        *n = G;
+    }
+    else if (choice == 3)
+    {
+        *n = B;
+    }
+    else if (choice == 4)
+    {
+        *n = Y;
+    }
+    else if (choice == 5)
+    {
+        *n = W;
+    }
+    else
+    {
+    }
+}
+
+//scroll one line read from in, starting at the already read character first
+//letters are pulled from the stream as they are needed, so any length works
+//returns the character that ended the line, '\n' or EOF
+int scrollMessage(struct canvas_t *canvas, const uint16_t *pal, int first, FILE *in)
+{
+    struct canvas_marquee_t m;
+    struct anim_clock_t clock;
+    int c = first, done = 0, hungry = 1;
+    unsigned steps = 0;
+    canvas_marquee_start(&m, canvas, first, MARQUEE_PROPORTIONAL, pal);
+    anim_start(&clock, scroll_fps);
+    for (;;)
+    {
+        if (hungry)
+        {
+            if (done)
+                break;
+            c = fgetc(in);
+            done = c == '\n' || c == EOF;
+            if (done)
+                canvas_marquee_flush(&m, canvas);
+            else
+                canvas_marquee_feed(&m, canvas, ascii_letter[c & 0x7F]);
+            //short letters may still fit beside the first one, fill the display before scrolling
+            hungry = marquee_room(&m.m) != 0;
+            continue;
+        }
+        //draw once per frame period, a late wakeup runs the steps of the skipped frames undrawn
+        if (steps == 0)
+        {
+            canvas_flush(canvas);
+            steps = anim_wait(&clock);
+            if (recorder != NULL && anim_write(recorder, canvas->pixel, steps * 1000 / scroll_fps) < 0)
+                perror("Error recording animation");
+        }
+        //each step moves "right" by 1 until the next letter is fully on the wall
+        hungry = canvas_marquee_step(&m, canvas);
+        steps--;
+    }
+    fprintf(stderr, "%lu frames, %lu skipped, jitter mean %ld us max %ld us\n", clock.frames, clock.skipped,
+            anim_jitter_mean(&clock) / 1000, clock.jitter_max / 1000);
+    canvas_fill(canvas, 0);
+    canvas_flush(canvas);
+    return c;
+}
+
+//show each frame of the stream for its own duration, scaled to the wall and flushed like
+//every other mode; returns the frames shown, -1 on a read error
+long playAnimation(struct canvas_t *canvas, struct anim_reader_t *r)
+{
+    struct timespec deadline;
+    uint16_t pixel[PX_COUNT];
+    unsigned duration;
+    long shown = 0;
+    int got;
+    px_fill(pixel, 0);                  //the first frame is coded against black
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    while ((got = anim_read(r, pixel, &duration)) > 0)
+    {
+        canvas_board(canvas, pixel);
+        canvas_flush(canvas);
+        shown++;
+        anim_add_ns(&deadline, (long long)duration * 1000000);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+            ;
+    }
+    return got < 0 ? -1 : shown;
+}
+
+//the board goes in the mode layer and the score over it, the caller composes
+void render(struct compositor_t *comp, const struct snake_game_t *g)
+{
+    struct fb_t board;
+    uint64_t head = CELL_BIT(CELL(g->snake.x, g->snake.y));
+    uint64_t score = (g->snake.length - 1) & 0xFF;
+    px_fill(&board.pixel[0][0], 0);
+    board.pixel[g->apple.x][g->apple.y] = palette[PAL_APPLE];
+    px_cells_over(&board.pixel[0][0], g->snake.occupied & ~head, palette[PAL_FG]);
+    board.pixel[g->snake.x][g->snake.y] = palette[PAL_HEAD];
+    comp_draw(comp, LAYER_MODE, &board.pixel[0][0], COMP_ALL);
+    px_fill(&board.pixel[0][0], palette[PAL_SCORE]);
+    comp_draw(comp, LAYER_SCORE, &board.pixel[0][0], score);
+}
+
+//put the layers on the wall, only when one of them changed since the last time
+static void uiCompose(struct ui_t *ui)
+{
+    if (ui->mode == MODE_TEXT || !comp_compose(&ui->comp))
+        return;
+    canvas_board(ui->canvas, ui->comp.out);
+    canvas_flush(ui->canvas);
+}
+
+//show the user matrix, on the display only when nothing is animating
+static void uiShowMatrix(struct ui_t *ui, int print)
+{
+    int i, j, k;
+    if (print)
+    {
+        for (i = 0, k = 0; i < 8; i++)
+        {
+            for (j = 0; j < 8; j++, k++)
+            {
+                ui->user_matrix[k] != 0 ? printf("1 ") : printf("0 ");  //prints out a 8x8 layout of the current configuration
+            }
+            printf("\n");
+        }
+    }
+    comp_draw(&ui->comp, LAYER_MATRIX, ui->user_matrix, COMP_ALL);
+    if (ui->mode == MODE_IDLE)
+        comp_show(&ui->comp, LAYER_MATRIX, 1);
+    uiCompose(ui);
+}
+
+//switch what the display loop animates, with the timer at period_ns (0 stops it)
+static void uiMode(struct ui_t *ui, enum ui_mode mode, long period_ns)
+{
+    if (ui->mode != MODE_IDLE)
+    {
+        fprintf(stderr, "%lu ticks, %lu missed deadlines\n", ui->sched.ticks - ui->ticks,
+                ui->sched.missed - ui->missed);
+    }
+    //the text mode drew over the composed frame, it has to be put back whole
+    if (ui->mode == MODE_TEXT)
+        comp_damage_all(&ui->comp);
+    ui->mode = mode;
+    ui->ticks = ui->sched.ticks;
+    ui->missed = ui->sched.missed;
+    if (sched_set_period(&ui->sched, period_ns) < 0)
+        perror("Error setting the tick timer");
+    //idle is blank until the matrix is asked for, like a fresh start
+    comp_show(&ui->comp, LAYER_MATRIX, 0);
+    comp_show(&ui->comp, LAYER_MODE, mode == MODE_SNAKE || mode == MODE_SPRITE || mode == MODE_RING);
+    comp_show(&ui->comp, LAYER_SCORE, mode == MODE_SNAKE);
+    //a new mode composes once it has drawn its first frame
+    if (mode == MODE_IDLE)
+        uiCompose(ui);
+}
+
+//queue glyphs until one has to scroll, returns 0 once the message has scrolled off
+static int uiTextFeed(struct ui_t *ui)
+{
+    unsigned char c;
+    while (ui->hungry)
+    {
+        if (ui->done)
+            return 0;
+        c = ui->text[ui->text_pos];
+        ui->done = c == '\0';
+        if (ui->done)
+        {
+            canvas_marquee_flush(&ui->marquee, ui->canvas);
+        }
+        else
+        {
+            canvas_marquee_feed(&ui->marquee, ui->canvas, ascii_letter[c & 0x7F]);
+            ui->text_pos++;
+        }
+        //short letters may still fit beside the first one, fill the display before scrolling
+        ui->hungry = marquee_room(&ui->marquee.m) != 0;
+    }
+    return 1;
+}
+
+static void uiTextDraw(struct ui_t *ui)
+{
+    canvas_flush(ui->canvas);
+    if (recorder != NULL && anim_write(recorder, ui->canvas->pixel, 1000 / scroll_fps) < 0)
+        perror("Error recording animation");
+}
+
+//show the next sprite frame and keep it up for its duration
+static void uiSpriteNext(struct ui_t *ui)
+{
+    const struct sprite_frame_t *f = sprite_player_next(&ui->sprites, &ui->player);
+    long ns;
+    if (f == NULL)
+    {
+        if (errno != 0)
+            perror("Error reading the sprite");
+        uiMode(ui, MODE_IDLE, 0);
+        return;
+    }
+    comp_draw(&ui->comp, LAYER_MODE, f->pixel, COMP_ALL);
+    uiCompose(ui);
+    ns = (f->duration_ms ? f->duration_ms : 1) * 1000000L;
+    if (ns != ui->sprite_ns)
+    {
+        ui->sprite_ns = ns;
+        sched_set_period(&ui->sched, ns);
+    }
+}
+
+//show the newest frame a producer has finished since the last tick, if there is one
+static void uiRingTake(struct ui_t *ui)
+{
+    struct fb_t f;
+    if (ring_take(&ui->ring, &f.pixel[0][0]))
+    {
+        comp_draw(&ui->comp, LAYER_MODE, &f.pixel[0][0], COMP_ALL);
+        uiCompose(ui);
+    }
+}
+
+//run one of the ui's own timers at period_ns, 0 stops it
+static void uiTimer(int fd, long period_ns)
+{
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+    its.it_interval.tv_sec = its.it_value.tv_sec = period_ns / 1000000000L;
+    its.it_interval.tv_nsec = its.it_value.tv_nsec = period_ns % 1000000000L;
+    if (timerfd_settime(fd, 0, &its, NULL) < 0)
+        perror("Error setting a timer");
+}
+
+//queue ticker glyphs until one has to scroll, returns 0 once the message has scrolled off
+static int uiTickerFeed(struct ui_t *ui)
+{
+    unsigned char c;
+    while (ui->ticker_hungry)
+    {
+        if (ui->ticker_done)
+            return 0;
+        c = ui->ticker_text[ui->ticker_pos];
+        ui->ticker_done = c == '\0';
+        if (ui->ticker_done)
+        {
+            marquee_flush(&ui->ticker);
+        }
+        else
+        {
+            marquee_feed(&ui->ticker, ascii_letter[c & 0x7F]);
+            ui->ticker_pos++;
+        }
+        ui->ticker_hungry = marquee_room(&ui->ticker) != 0;
+    }
+    return 1;
+}
+
+//the lit pixels of the ticker window go over whatever is below, the rest shows through
+static void uiTickerDraw(struct ui_t *ui)
+{
+    uint16_t window[PX_COUNT];
+    marquee_frame(&ui->ticker, window, palette);
+    comp_draw(&ui->comp, LAYER_TICKER, window, comp_glyph_cover(ui->ticker.win));
+    uiCompose(ui);
+}
+
+//scroll the ticker by the periods that passed, hide it once the message is through
+static void uiTickerTick(struct ui_t *ui)
+{
+    uint64_t expired;
+    if (read(ui->ticker_fd, &expired, sizeof(expired)) != sizeof(expired) || !ui->ticker_on)
+        return;
+    while (expired--)
+    {
+        ui->ticker_hungry = marquee_step(&ui->ticker);
+        if (!uiTickerFeed(ui))
+        {
+            ui->ticker_on = 0;
+            uiTimer(ui->ticker_fd, 0);
+            comp_show(&ui->comp, LAYER_TICKER, 0);
+            uiCompose(ui);
+            return;
+        }
+    }
+    uiTickerDraw(ui);
+}
+
+//rebuild the correction tables and show the wall through them; the wall is presented every
+//refresh while fading, or while dithering does something
+static void uiCorrect(struct ui_t *ui)
+{
+    int refresh;
+    gamma_build(&correction);
+    ui->canvas->gamma = gamma_identity(&correction) ? NULL : &correction;
+    canvas_refresh(ui->canvas);
+    refresh = ui->fade_step < ui->fade_steps || (correction.dither && ui->canvas->gamma != NULL);
+    if (refresh != ui->refreshing)
+    {
+        uiTimer(ui->refresh_fd, refresh ? 1000000000L / REFRESH_HZ : 0);
+        ui->refreshing = refresh;
+    }
+}
+
+//step a fade by the refreshes that passed, or just present again for the next dither phase
+static void uiRefresh(struct ui_t *ui)
+{
+    uint64_t expired;
+    if (read(ui->refresh_fd, &expired, sizeof(expired)) != sizeof(expired) || !ui->refreshing)
+        return;
+    if (ui->fade_step < ui->fade_steps)
+    {
+        ui->fade_step += expired;
+        if (ui->fade_step > ui->fade_steps)
+            ui->fade_step = ui->fade_steps;
+        correction.level = ui->fade_from + ((long)ui->fade_to - (long)ui->fade_from) * (long)ui->fade_step /
+                                               (long)ui->fade_steps;
+        uiCorrect(ui);
+        return;
+    }
+    canvas_refresh(ui->canvas);
+}
+
+//advance whatever is on the display by the deadlines that passed
+static void uiTick(struct ui_t *ui)
+{
+    unsigned long steps;
+    switch (ui->mode)
+    {
+    case MODE_IDLE:
+        break;
+    case MODE_TEXT:
+        //a late wakeup runs the steps of the skipped frames undrawn
+        for (steps = ui->sched.expired; steps > 0; steps--)
+        {
+            //each step moves "right" by 1 until the next letter is fully on the display
+            ui->hungry = canvas_marquee_step(&ui->marquee, ui->canvas);
+            if (!uiTextFeed(ui))
+            {
+                uiMode(ui, MODE_IDLE, 0);
+                return;
+            }
+        }
+        uiTextDraw(ui);
+        break;
+    case MODE_SNAKE:
+        //fixed timestep, one step per deadline and a few extra to catch up when behind
+        steps = ui->sched.expired < SNAKE_MAX_CATCHUP ? ui->sched.expired : SNAKE_MAX_CATCHUP;
+        while (steps--)
+        {
+            snake_take_turn(&ui->game, &ui->input.queue);
+            snake_step(&ui->game);
+        }
+        render(&ui->comp, &ui->game);
+        uiCompose(ui);
+        if (snake_period(&ui->game, &speed) != ui->sched.period_ns)
+            sched_set_period(&ui->sched, snake_period(&ui->game, &speed));
+        break;
+    case MODE_SPRITE:
+        uiSpriteNext(ui);
+        break;
+    case MODE_RING:
+        uiRingTake(ui);
+        break;
+    }
+}
+
+//joystick moves steer the snake, outside the game they are dropped
+static void uiJoystick(struct ui_t *ui)
+{
+    unsigned short code;
+    input_thread_ack(&ui->input);
+    if (ui->mode == MODE_SNAKE)
+    {
+        if (atomic_exchange(&ui->input.quit, 0))
+            uiMode(ui, MODE_IDLE, 0);
+        return;
+    }
+    while (input_pop(&ui->input.queue, &code))
+        ;
+    atomic_store(&ui->input.quit, 0);
+}
+
+static int uiHelp(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    cmd_help(ui->commands, stdout);
+    return 0;
+}
+
+//color 1-5, a color name or an RGB565 value such as 0xF800
+static int uiColor(void *ctx, char *args)
+{
+    static const char *names[] = {"red", "green", "blue", "yellow", "white"};
+    char *end;
+    unsigned long v;
+    int i;
+    for (i = 0; i < 5; i++)
+    {
+        if (strcmp(args, names[i]) == 0)
+            break;
+    }
+    if (i < 5)
+    {
+        colorSet(i + 1, &palette[PAL_FG]);
+    }
+    else
+    {
+        v = strtoul(args, &end, 0);
+        if (end == args || *end != '\0' || v > 0xFFFF)
+            return -1;
+        if (v >= 1 && v <= 5 && strncmp(args, "0x", 2) != 0)
+            colorSet(v, &palette[PAL_FG]);
+        else
+            palette[PAL_FG] = v;
+    }
+    printf("Color changed to:0x%04X\n", palette[PAL_FG]);
+    return 0;
+}
+
+//set r c [off], light a pixel of the user matrix in the current color or turn it off
+static int uiSet(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    int row, col;
+    char off[4] = "";
+    if (sscanf(args, "%d %d %3s", &row, &col, off) < 2)
+        return -1;
+    if (row <= 0 || col <= 0 || row > 8 || col > 8 || (off[0] != '\0' && strcmp(off, "off") != 0))
+        return -1;
+    ui->user_matrix[(row - 1) * 8 + col - 1] = off[0] ? 0 : palette[PAL_FG];
+    ui->dirty = 1;
+    uiShowMatrix(ui, 0);
+    return 0;
+}
+
+static int uiClear(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    px_fill(ui->user_matrix, 0);
+    ui->dirty = 1;
+    uiShowMatrix(ui, 0);
+    return 0;
+}
+
+static int uiShow(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    printf("USER MATRIX\n");
+    uiShowMatrix(ui, 1);
+    return 0;
+}
+
+//text message, scrolled by the display loop
+static int uiText(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    if (*args == '\0')
+        return -1;
+    snprintf(ui->text, sizeof(ui->text), "%s", args);
+    canvas_marquee_start(&ui->marquee, ui->canvas, ui->text[0], MARQUEE_PROPORTIONAL, palette);
+    ui->text_pos = 1;
+    ui->hungry = 1;
+    ui->done = 0;
+    uiTextFeed(ui);
+    uiMode(ui, MODE_TEXT, 1000000000L / scroll_fps);
+    uiTextDraw(ui);
+    return 0;
+}
+
+static int uiFps(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    unsigned long fps = strtoul(args, NULL, 10);
+    if (fps == 0)
+        return -1;
+    scroll_fps = fps;
+    if (ui->mode == MODE_TEXT)
+        sched_set_period(&ui->sched, 1000000000L / scroll_fps);
+    if (ui->ticker_on)
+        uiTimer(ui->ticker_fd, 1000000000L / scroll_fps);
+    return 0;
+}
+
+//notify message, scrolled over whatever the display shows without stopping it
+static int uiNotify(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    if (*args == '\0')
+        return -1;
+    snprintf(ui->ticker_text, sizeof(ui->ticker_text), "%s", args);
+    marquee_start(&ui->ticker, ui->ticker_text[0], MARQUEE_PROPORTIONAL);
+    ui->ticker_pos = 1;
+    ui->ticker_hungry = 1;
+    ui->ticker_done = 0;
+    uiTickerFeed(ui);
+    ui->ticker_on = 1;
+    uiTimer(ui->ticker_fd, 1000000000L / scroll_fps);
+    comp_show(&ui->comp, LAYER_TICKER, 1);
+    uiTickerDraw(ui);
+    return 0;
+}
+
+static int uiSnake(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    unsigned short code;
+    if (!ui->joystick)
+        fprintf(stderr, "no joystick, the snake will not turn\n");
+    while (ui->joystick && input_pop(&ui->input.queue, &code))
+        ;
+    atomic_store(&ui->input.quit, 0);
+    snake_seed(&ui->game, time(NULL));
+    reset(&ui->game);
+    uiMode(ui, MODE_SNAKE, snake_period(&ui->game, &speed));
+    render(&ui->comp, &ui->game);
+    uiCompose(ui);
+    return 0;
+}
+
+//sprite list | sprite add name ms | sprite play name [loops]
+static int uiSprite(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    char verb[8], name[SPRITE_NAME];
+    unsigned n = 0;
+    int id, got;
+    uint32_t i;
+    got = sscanf(args, "%7s %23s %u", verb, name, &n);
+    if (got < 1)
+        return -1;
+    if (!ui->sprites_open)
+    {
+        //reads the index only, frames are read as they are played
+        if (sprite_open(&ui->sprites, SPRITE_FILE) < 0)
+        {
+            perror("Error opening " SPRITE_FILE);
+            return 0;
+        }
+        ui->sprites_open = 1;
+    }
+    if (strcmp(verb, "list") == 0)
+    {
+        for (i = 0; i < ui->sprites.header.count; i++)
+            printf("%-*.*s %u frames\n", SPRITE_NAME, SPRITE_NAME, ui->sprites.index[i].name, ui->sprites.index[i].frames);
+        return 0;
+    }
+    if (strcmp(verb, "add") == 0 && got == 3)
+    {
+        id = sprite_append(&ui->sprites, name, ui->user_matrix, n);    //a new name starts a new sprite
+        if (id < 0)
+            perror("Error adding the frame");
+        else
+            printf("%s now has %u frames\n", name, ui->sprites.index[id].frames);
+        return 0;
+    }
+    if (strcmp(verb, "play") == 0 && got >= 2)
+    {
+        id = sprite_find(&ui->sprites, name);
+        if (id < 0)
+        {
+            printf("No sprite called %s\n", name);
+            return 0;
+        }
+        sprite_player_start(&ui->player, id, n);
+        ui->sprite_ns = 0;
+        uiMode(ui, MODE_SPRITE, 0);
+        uiSpriteNext(ui);
+        return 0;
+    }
+    return -1;
+}
+
+//ring [fps], show what other processes put in RING_FILE until stopped
+static int uiRing(void *ctx, char *args)
+{
+    static const uint16_t black[PX_COUNT];
+    struct ui_t *ui = ctx;
+    char *end;
+    unsigned long fps = strtoul(args, &end, 10);
+    if (*args == '\0')
+        fps = RING_FPS;
+    else if (end == args || *end != '\0' || fps == 0 || fps > 1000)
+        return -1;
+    if (!ui->ring_open)
+    {
+        if (ring_create(&ui->ring, RING_FILE) < 0)
+        {
+            perror("Error creating " RING_FILE);
+            return 0;
+        }
+        ui->ring_open = 1;
+    }
+    //the frame last shown comes back, and black until a producer has submitted one
+    ui->ring.shown = 0;
+    uiMode(ui, MODE_RING, 1000000000L / fps);
+    comp_draw(&ui->comp, LAYER_MODE, black, COMP_ALL);
+    uiRingTake(ui);
+    uiCompose(ui);
+    return 0;
+}
+
+static int uiStop(void *ctx, char *args)
+{
+    uiMode(ctx, MODE_IDLE, 0);
+    return 0;
+}
+
+static int uiWait(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    ui->waiting = ui->mode != MODE_IDLE;
+    return 0;
+}
+
+static int uiQuit(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    ui->running = 0;
+    return 0;
+}
+
+//bright level [ms], brightness 0-256, reached over ms when given
+static int uiBright(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    unsigned level, ms = 0;
+    if (sscanf(args, "%u %u", &level, &ms) < 1 || level > GAMMA_LEVEL_MAX)
+        return -1;
+    ui->fade_from = correction.level;
+    ui->fade_to = level;
+    ui->fade_step = 0;
+    ui->fade_steps = (unsigned long)ms * REFRESH_HZ / 1000;
+    if (ui->fade_steps == 0)
+        correction.level = level;
+    uiCorrect(ui);
+    return 0;
+}
+
+//gamma value, 1 for none, about 2.2 makes mid levels look evenly spaced
+static int uiGamma(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    char *end;
+    float gamma = strtof(args, &end);
+    if (end == args || *end != '\0' || !(gamma >= 0.1f && gamma <= 5.0f))
+        return -1;
+    correction.gamma = gamma;
+    uiCorrect(ui);
+    return 0;
+}
+
+static int uiDither(void *ctx, char *args)
+{
+    struct ui_t *ui = ctx;
+    if (strcmp(args, "on") != 0 && strcmp(args, "off") != 0)
+        return -1;
+    correction.dither = strcmp(args, "on") == 0;
+    uiCorrect(ui);
+    return 0;
+}
+
+static const struct cmd_t ui_commands[] = {
+    {"help", "", uiHelp},
+    {"color", "1-5|red|green|blue|yellow|white|0xRGB565", uiColor},
+    {"set", "row col [off]", uiSet},
+    {"clear", "", uiClear},
+    {"show", "", uiShow},
+    {"text", "message", uiText},
+    {"notify", "message (scrolled over what is showing)", uiNotify},
+    {"bright", "0-256 [fade_ms]", uiBright},
+    {"gamma", "value (1 for none, 2.2 typical)", uiGamma},
+    {"dither", "on|off (smooth dim levels by varying them over frames)", uiDither},
+    {"fps", "columns_per_second", uiFps},
+    {"snake", "", uiSnake},
+    {"sprite", "list | add name ms | play name [loops]", uiSprite},
+    {"ring", "[fps] (show frames other processes submit to " RING_FILE ")", uiRing},
+    {"stop", "", uiStop},
+    {"wait", "(hold further commands until the animation ends)", uiWait},
+    {"quit", "", uiQuit},
+    {NULL, NULL, NULL},
+};
+
+int uiInit(struct ui_t *ui, struct canvas_t *canvas)
+{
+    memset(ui, 0, sizeof(*ui));
+    ui->canvas = canvas;
+    ui->commands = ui_commands;
+    ui->running = 1;
+    ui->mode = MODE_IDLE;
+    ui->prompt = isatty(STDIN_FILENO);
+
+    ui->saved = matrix_store_open(&ui->store, MATRIX_SAVE, MATRIX_LEGACY);     //maps the save, importing saved.txt the first time
+    if (ui->saved == MATRIX_FOREIGN)
+        fprintf(stderr, MATRIX_SAVE " is not a save this version can read, it is left alone and changes will not be saved\n");
+    else if (ui->saved < 0)
+        perror("Error opening " MATRIX_SAVE ", changes will not be saved");
+    else if (ui->saved == MATRIX_CREATED)
+        printf("saved file not found, creating a new save\n");
+    else if (ui->saved == MATRIX_IMPORTED)
+        printf("imported " MATRIX_LEGACY " into a new save\n");
+    if (ui->saved < 0 || matrix_store_load(&ui->store, ui->user_matrix) < 0)  //check if the save holds a good matrix
+    {
+        if (ui->saved == MATRIX_OPENED)
+            printf("Corrupted save, creating new save\n");
+        px_fill(ui->user_matrix, 0);                //initialize a new matrix if there is no usable save
+    }
+
+    //z is the layer id, so the layers stack in enum order
+    comp_init(&ui->comp);
+    comp_add(&ui->comp, LAYER_MATRIX, COMP_OPAQUE);
+    comp_add(&ui->comp, LAYER_MODE, COMP_OPAQUE);
+    comp_add(&ui->comp, LAYER_SCORE, SCORE_OPACITY);
+    comp_add(&ui->comp, LAYER_TICKER, COMP_OPAQUE);
+
+    cmd_reader_init(&ui->cmds, STDIN_FILENO);                   //stdin stays blocking, it is read only when ready
+    ui->joystick = evpoll.fd >= 0 && input_thread_start(&ui->input, evpoll.fd) == 0;
+    if (evpoll.fd >= 0 && !ui->joystick)
+        perror("Error starting input thread");
+    if (sched_init(&ui->sched, 0, ui->joystick ? ui->input.wakefd : -1) < 0)
+        goto err_input;
+    //the ticker scrolls at its own rate whatever the mode's timer is doing
+    ui->ticker_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (ui->ticker_fd < 0)
+        goto err_sched;
+    if (sched_watch(&ui->sched, ui->ticker_fd, UI_TICKER) < 0)
+        goto err_ticker;
+    ui->refresh_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (ui->refresh_fd < 0)
+        goto err_ticker;
+    if (sched_watch(&ui->sched, ui->refresh_fd, UI_REFRESH) < 0)
+        goto err_refresh;
+    //epoll refuses plain files, a script redirected from one is simply always ready
+    ui->pollable = sched_watch(&ui->sched, STDIN_FILENO, UI_COMMAND) == 0;
+    if (!ui->pollable && errno != EPERM)
+        goto err_refresh;
+    ui->watching = ui->pollable;
+    printf("%sCOMMANDS%s (help for a list)\n", BOLDBLACK, RESET);
+    if (ui->prompt)
+        printf("> ");
+    fflush(stdout);
+    return 0;
+
+err_refresh:
+    close(ui->refresh_fd);
+err_ticker:
+    close(ui->ticker_fd);
+err_sched:
+    sched_close(&ui->sched);
+err_input:
+    if (ui->joystick)
+        input_thread_stop(&ui->input);
+    if (ui->saved >= 0)
+        matrix_store_close(&ui->store);
+    return -1;
+}
+
+//run every command that is ready, unless a wait holds them
+static void uiCommands(struct ui_t *ui)
+{
+    char line[CMD_LINE_MAX];
+    int got, ran = 0;
+    while (ui->running && !ui->eof && !(ui->waiting && ui->mode != MODE_IDLE))
+    {
+        ui->waiting = 0;
+        got = cmd_read_line(&ui->cmds, line);
+        if (got == 0)
+        {
+            //one read per readiness so it never blocks, a plain file is always ready
+            if (ui->pollable && !ui->readable)
+                break;
+            ui->readable = 0;
+            cmd_reader_fill(&ui->cmds);
+            continue;
+        }
+        if (got < 0)
+            ui->eof = 1;
+        else
+            cmd_dispatch(ui->commands, ui, line);
+        ran = 1;
+    }
+    //one write for a whole batch of set commands
+    if (ui->dirty && ui->saved >= 0)
+    {
+        if (matrix_store_save(&ui->store, ui->user_matrix) < 0)   //write the matrix into the save file
+            perror("Error saving the matrix");
+        ui->dirty = 0;
+    }
+    if (ran && ui->prompt && ui->running && !ui->eof)
+        printf("> ");
+    fflush(stdout);
+}
+
+//the event loop, commands, joystick and animation ticks all wake the same epoll
+void uiRun(struct ui_t *ui)
+{
+    int events, watch;
+    while (ui->running)
+    {
+        uiCommands(ui);
+        //with the input over, the last animation and ticker still play out, but a game or the ring
+        //never ends by itself
+        if (!ui->running || (ui->eof && (ui->mode == MODE_SNAKE || ui->mode == MODE_RING ||
+                                         (ui->mode == MODE_IDLE && !ui->ticker_on))))
+            break;
+        //stdin stays out of the epoll set while a wait holds it, so it cannot spin the loop
+        watch = ui->pollable && !ui->eof && !(ui->waiting && ui->mode != MODE_IDLE);
+        if (watch != ui->watching)
+        {
+            if (watch)
+                sched_watch(&ui->sched, STDIN_FILENO, UI_COMMAND);
+            else
+                sched_unwatch(&ui->sched, STDIN_FILENO);
+            ui->watching = watch;
+        }
+        events = sched_wait(&ui->sched);
+        if (events < 0)
+            break;
+        if (events & UI_COMMAND)
+            ui->readable = 1;
+        if (events & SCHED_INPUT)
+            uiJoystick(ui);
+        if (events & SCHED_TICK)
+            uiTick(ui);
+        if (events & UI_TICKER)
+            uiTickerTick(ui);
+        if (events & UI_REFRESH)
+            uiRefresh(ui);
+    }
+}
+
+void uiClose(struct ui_t *ui)
+{
+    if (ui->mode != MODE_IDLE)
+        uiMode(ui, MODE_IDLE, 0);
+    if (ui->saved >= 0)
+        matrix_store_close(&ui->store);
+    if (ui->sprites_open)
+        sprite_close(&ui->sprites);
+    if (ui->ring_open)
+    {
+        if (ui->ring.torn)
+            fprintf(stderr, "frame ring: %lu torn reads\n", ui->ring.torn);
+        ring_detach(&ui->ring);
+        unlink(RING_FILE);
+    }
+    close(ui->refresh_fd);
+    close(ui->ticker_fd);
+    sched_close(&ui->sched);
+    if (ui->joystick)
+        input_thread_stop(&ui->input);
+}
@@ -0,0 +1,155 @@
+/*
+ *  Work-stealing batch runner, spreads a numbered range of independent
+ *  items over a fixed set of threads.
+ *
+ *  Every worker owns a contiguous slice of the range, packed as lo | hi << 32
+ *  into one 64-bit atomic so it can be changed with a single CAS. The owner
+ *  eats its slice from the bottom a few items at a time; a worker whose own
+ *  slice ran dry steals the top half of someone else's. Each worker sits on
+ *  its own cache line, so the owner's fast path never contends with another
+ *  core unless a thief is actually taking work from it.
+ *
+ *  Nothing is allocated: the workers live in the caller's struct batch_t,
+ *  and the calling thread runs worker 0 itself.
+ */
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define BATCH_MAX_WORKERS 64
+#define BATCH_CHUNK 8 //items the owner claims per CAS
+
+#define BATCH_LO(r) ((uint32_t)(r))
+#define BATCH_HI(r) ((uint32_t)((r) >> 32))
+#define BATCH_RANGE(lo, hi) ((uint64_t)(lo) | (uint64_t)(hi) << 32)
+
+//process items first .. first + count - 1 on the given worker
+typedef void (*batch_fn)(void *ctx, unsigned worker, uint32_t first, uint32_t count);
+
+struct batch_t;
+
+struct batch_worker_t
+{
+    _Alignas(64) _Atomic uint64_t range; //items [lo, hi) not yet claimed
+    struct batch_t *batch;
+    pthread_t thread;
+    unsigned id;
+    unsigned long steals; //successful steals, for the curious
+};
+
+struct batch_t
+{
+    struct batch_worker_t worker[BATCH_MAX_WORKERS];
+    unsigned workers;
+    batch_fn fn;
+    void *ctx;
+};
+
+//owner side, claim up to BATCH_CHUNK items from the bottom of the slice, 0 when it is empty
+static inline uint32_t batch_claim(struct batch_worker_t *w, uint32_t *first)
+{
+    uint64_t r = atomic_load_explicit(&w->range, memory_order_relaxed);
+    uint32_t n;
+
+    do
+    {
+        if (BATCH_LO(r) >= BATCH_HI(r))
+            return 0;
+        n = BATCH_HI(r) - BATCH_LO(r);
+        n = n < BATCH_CHUNK ? n : BATCH_CHUNK;
+    } while (!atomic_compare_exchange_weak_explicit(&w->range, &r, BATCH_RANGE(BATCH_LO(r) + n, BATCH_HI(r)),
+                                                    memory_order_acq_rel, memory_order_relaxed));
+    *first = BATCH_LO(r);
+    return n;
+}
+
+//thief side, move the top half of victim's slice into w's (empty) slice, returns 1 on success
+static inline int batch_steal(struct batch_worker_t *w, struct batch_worker_t *victim)
+{
+    uint64_t r = atomic_load_explicit(&victim->range, memory_order_relaxed);
+    uint32_t mid;
+
+    do
+    {
+        //a single item left is as good as taken, its owner is about to claim it
+        if (BATCH_LO(r) + 1 >= BATCH_HI(r))
+            return 0;
+        mid = BATCH_LO(r) + (BATCH_HI(r) - BATCH_LO(r)) / 2;
+    } while (!atomic_compare_exchange_weak_explicit(&victim->range, &r, BATCH_RANGE(BATCH_LO(r), mid),
+                                                    memory_order_acq_rel, memory_order_relaxed));
+    atomic_store_explicit(&w->range, BATCH_RANGE(mid, BATCH_HI(r)), memory_order_release);
+    w->steals++;
+    return 1;
+}
+
+static inline void *batch_worker_main(void *arg)
+{
+    struct batch_worker_t *w = arg;
+    struct batch_t *b = w->batch;
+    uint32_t first, n;
+    unsigned i;
+
+    for (;;)
+    {
+        while ((n = batch_claim(w, &first)) > 0)
+            b->fn(b->ctx, w->id, first, n);
+
+        //own slice is done, go round the others once looking for something to take
+        for (i = 1; i < b->workers; i++)
+        {
+            if (batch_steal(w, &b->worker[(w->id + i) % b->workers]))
+                break;
+        }
+        if (i == b->workers)
+            return NULL;
+    }
+}
+
+//run fn over items 0 .. items - 1 on up to workers threads, returns once all are done
+static inline int batch_run(struct batch_t *b, unsigned workers, uint32_t items, batch_fn fn, void *ctx)
+{
+    struct batch_worker_t *w;
+    unsigned i, started;
+
+    if (workers < 1)
+        workers = 1;
+    if (workers > BATCH_MAX_WORKERS)
+        workers = BATCH_MAX_WORKERS;
+    b->workers = workers;
+    b->fn = fn;
+    b->ctx = ctx;
+
+    //hand out equal slices up front, stealing only has to fix up the imbalance
+    for (i = 0; i < workers; i++)
+    {
+        w = &b->worker[i];
+        w->batch = b;
+        w->id = i;
+        w->steals = 0;
+        atomic_init(&w->range, BATCH_RANGE((uint64_t)items * i / workers,
+                                           (uint64_t)items * (i + 1) / workers));
+    }
+    for (started = 1; started < workers; started++)
+    {
+        w = &b->worker[started];
+        if (pthread_create(&w->thread, NULL, batch_worker_main, w) != 0)
+            break;
+    }
+    //whatever a missing thread would have done gets stolen by the ones that did start
+    batch_worker_main(&b->worker[0]);
+    for (i = 1; i < started; i++)
+        pthread_join(b->worker[i].thread, NULL);
+    //a thread that failed to start may still own items nobody managed to steal
+    for (i = started; i < workers; i++)
+    {
+        uint32_t first, n;
+        while ((n = batch_claim(&b->worker[i], &first)) > 0)
+            fn(ctx, 0, first, n);
+    }
+    return started == workers ? 0 : -1;
+}
+
+#endif
@@ -0,0 +1,956 @@
+/*
+ *  Headless benchmarks for the LED matrix code, run against the emulated
+ *  Sense HAT framebuffer so they work on any Linux machine.
+ *
+ *    bench snake [-n games] [-r seed]    autoplayer games back to back
+ *    bench parallel [-n games] [-j threads] [-r seed] [-S]
+ *                                        headless games spread over all cores,
+ *                                        -S sweeps the thread count for speedup
+ *    bench batch [-n boards] [-t ticks] [-r seed]
+ *                                        random-turn boards stepped one at a time
+ *                                        and SNAKE_LANES at a time, checked bit-exact
+ *    bench pixels [-n rounds]            pixel_ops.h kernels and the gamma.h pass, ns
+ *                                        per full frame; the checksum must not change
+ *                                        with -DPX_SCALAR
+ *    bench codec [-n frames] [-r rounds] anim_codec.h bytes per frame and encode and
+ *                                        decode ns per frame on scrolling text, snake
+ *                                        games and full-frame fades, checked lossless
+ *    bench net [-n frames] [-t tiles] [-l loss_percent]
+ *                                        netframe.h over a UNIX socket to a receiver
+ *                                        thread, text across a wall of tiles, with -l
+ *                                        dropping packets; the panels must match
+ *    bench ring [-s seconds] [-j producers]
+ *                                        frame_ring.h with producer threads
+ *                                        submitting flat out; every frame the
+ *                                        compositor takes must be whole
+ *
+ *  Build with:  gcc -Wall -O2 -march=native bench.c -o bench -pthread -lm -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+ *
+ *  The --wrap flags route every allocation made by the benchmarked code
+ *  through a counter, reported per game, and -lm is for powf() in gamma.h.
+ *  The surface is the file named by SENSE_HAT_FB, /dev/shm/rpic-bench by
+ *  default.
+ */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+
+#include "ascii_letter.h"
+#include "sense_hat.h"
+#include "frame.h"
+#include "snake_engine.h"
+#include "snake_ai.h"
+#include "snake_render.h"
+#include "batch.h"
+#include "snake_batch.h"
+#include "marquee.h"
+#include "anim_codec.h"
+#include "gamma.h"
+#include "canvas.h"
+#include "netframe.h"
+#include "frame_ring.h"
+
+#define BENCH_FB "/dev/shm/rpic-bench"
+#define MAX_GAME_TICKS 100000 //a game still running after this many moves is cut short
+
+static atomic_ulong allocations;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    return __real_malloc(size);
+}
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+    atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    return __real_calloc(nmemb, size);
+}
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    return __real_realloc(ptr, size);
+}
+
+static double elapsed(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+//map the emulated display and attach a frame to it
+static void *open_surface(struct frame_t *frame, int *fbfd)
+{
+    const char *path = getenv(SENSE_FB_ENV) ? getenv(SENSE_FB_ENV) : BENCH_FB;
+    void *map;
+
+    *fbfd = emu_open_fb(path);
+    if (*fbfd < 0)
+    {
+        perror(path);
+        return NULL;
+    }
+    map = mmap(0, SENSE_FB_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, *fbfd, 0);
+    if (map == MAP_FAILED)
+    {
+        perror("Error mmapping the surface");
+        close(*fbfd);
+        return NULL;
+    }
+    frame_init(frame, map);
+    return map;
+}
+
+//play one autoplayer game to the end, returns its ticks and final length
+static unsigned long play_game(struct snake_game_t *g, struct frame_t *frame, unsigned int *length)
+{
+    unsigned long ticks;
+
+    for (ticks = 1;; ticks++)
+    {
+        *length = g->snake.length;
+        change_dir(g, snake_ai_key(g));
+        if (snake_step(g))
+            return ticks;
+        if (frame)
+            snake_render(frame, g);
+        if (ticks == MAX_GAME_TICKS)
+        {
+            *length = g->snake.length;
+            reset(g);
+            return ticks;
+        }
+    }
+}
+
+static int bench_snake(int argc, char *argv[])
+{
+    struct frame_t frame;
+    struct snake_game_t game;
+    struct timespec start;
+    unsigned long games = 1000, g, ticks, total_ticks = 0, total_length = 0, allocs;
+    unsigned int seed = 1, length;
+    uint64_t checksum = 1469598103934665603ULL; //FNV-1a over every game's length and ticks
+    double secs;
+    void *map;
+    int opt, fbfd;
+
+    while ((opt = getopt(argc, argv, "n:r:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            games = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            seed = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: bench snake [-n games] [-r seed]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if (games == 0)
+        return EXIT_FAILURE;
+
+    map = open_surface(&frame, &fbfd);
+    if (map == NULL)
+        return EXIT_FAILURE;
+
+    snake_seed(&game, seed);
+    reset(&game);
+    allocs = atomic_load(&allocations);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (g = 0; g < games; g++)
+    {
+        ticks = play_game(&game, &frame, &length);
+        total_ticks += ticks;
+        total_length += length;
+        checksum = (checksum ^ length) * 1099511628211ULL;
+        checksum = (checksum ^ ticks) * 1099511628211ULL;
+    }
+    secs = elapsed(&start);
+    allocs = atomic_load(&allocations) - allocs;
+
+    printf("snake: %lu games, %lu ticks in %.3f s\n", games, total_ticks, secs);
+    printf("  %.0f ticks/s, %.0f games/s\n", total_ticks / secs, games / secs);
+    printf("  mean game %.1f ticks, mean final length %.2f\n",
+           (double)total_ticks / games, (double)total_length / games);
+    printf("  %.2f allocations/game\n", (double)allocs / games);
+    printf("  checksum %016llx\n", (unsigned long long)checksum);
+
+    munmap(map, SENSE_FB_SIZE);
+    close(fbfd);
+    //the engine is meant to run without touching the heap, fail the run if that regresses
+    return allocs == 0 ? 0 : EXIT_FAILURE;
+}
+
+//per worker totals, one cache line each so the workers never write to a shared line
+struct parallel_stats_t
+{
+    _Alignas(64) unsigned long games;
+    unsigned long ticks;
+    unsigned long length;
+    uint64_t checksum; //sum of per game hashes, the same whatever the split
+};
+
+struct parallel_t
+{
+    unsigned int seed;
+    struct parallel_stats_t stats[BATCH_MAX_WORKERS];
+};
+
+static void parallel_games(void *ctx, unsigned worker, uint32_t first, uint32_t count)
+{
+    struct parallel_t *p = ctx;
+    struct parallel_stats_t *st = &p->stats[worker];
+    struct snake_game_t game;
+    unsigned long ticks;
+    unsigned int length;
+    uint64_t h;
+    uint32_t i;
+
+    for (i = first; i < first + count; i++)
+    {
+        //every game gets its own generator seeded from its number, so results do not
+        //depend on which thread ran it or how many threads there were
+        snake_seed(&game, (uint64_t)p->seed << 32 | i);
+        reset(&game);
+        ticks = play_game(&game, NULL, &length);
+
+        h = 1469598103934665603ULL;
+        h = (h ^ i) * 1099511628211ULL;
+        h = (h ^ length) * 1099511628211ULL;
+        h = (h ^ ticks) * 1099511628211ULL;
+        st->games++;
+        st->ticks += ticks;
+        st->length += length;
+        st->checksum += h;
+    }
+}
+
+//run games on threads workers, returns the wall time
+static double parallel_run(struct parallel_t *p, struct batch_t *b, unsigned threads, unsigned long games,
+                           struct parallel_stats_t *total, unsigned long *steals)
+{
+    struct timespec start;
+    double secs;
+    unsigned i;
+
+    memset(p->stats, 0, sizeof(p->stats));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (batch_run(b, threads, games, parallel_games, p) < 0)
+        fprintf(stderr, "warning: not every worker thread could be started\n");
+    secs = elapsed(&start);
+
+    memset(total, 0, sizeof(*total));
+    *steals = 0;
+    for (i = 0; i < b->workers; i++)
+    {
+        total->games += p->stats[i].games;
+        total->ticks += p->stats[i].ticks;
+        total->length += p->stats[i].length;
+        total->checksum += p->stats[i].checksum;
+        *steals += b->worker[i].steals;
+    }
+    return secs;
+}
+
+static int bench_parallel(int argc, char *argv[])
+{
+    static struct parallel_t p;
+    static struct batch_t batch;
+    struct parallel_stats_t total;
+    unsigned long games = 10000, steals;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned threads = cpus > 0 ? cpus : 1, t;
+    int opt, sweep = 0;
+    double secs, base = 0;
+
+    p.seed = 1;
+    while ((opt = getopt(argc, argv, "n:j:r:S")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            games = strtoul(optarg, NULL, 10);
+            break;
+        case 'j':
+            threads = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            p.seed = strtoul(optarg, NULL, 10);
+            break;
+        case 'S':
+            sweep = 1;
+            break;
+        default:
+            fprintf(stderr, "usage: bench parallel [-n games] [-j threads] [-r seed] [-S]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if (games == 0 || games > UINT32_MAX || threads == 0)
+        return EXIT_FAILURE;
+    if (threads > BATCH_MAX_WORKERS)
+        threads = BATCH_MAX_WORKERS;
+
+    printf("parallel: %lu games\n", games);
+    //sweep 1, 2, 4 .. threads, otherwise just the one run
+    for (t = sweep ? 1 : threads;; t = t * 2 < threads ? t * 2 : threads)
+    {
+        secs = parallel_run(&p, &batch, t, games, &total, &steals);
+        if (t == 1)
+            base = secs;
+        printf("  %2u threads: %.3f s, %.0f ticks/s, %.0f games/s", t, secs, total.ticks / secs, games / secs);
+        if (base > 0)
+            printf(", speedup %.2f", base / secs);
+        printf(", %lu steals\n", steals);
+        if (t == threads)
+            break;
+    }
+    printf("  mean game %.1f ticks, mean final length %.2f\n",
+           (double)total.ticks / games, (double)total.length / games);
+    printf("  checksum %016llx\n", (unsigned long long)total.checksum);
+    //every game must have been played exactly once however the work was split
+    return total.games == games ? 0 : EXIT_FAILURE;
+}
+
+//time rounds calls of one pixel op and fold its last output into the checksum
+#define PIXEL_BENCH(name, call)                                                          \
+    do                                                                                   \
+    {                                                                                    \
+        clock_gettime(CLOCK_MONOTONIC, &start);                                          \
+        for (i = 0; i < rounds; i++)                                                     \
+        {                                                                                \
+            call;                                                                        \
+            __asm__ volatile("" : : "r"(dst) : "memory");                                \
+        }                                                                                \
+        secs = elapsed(&start);                                                          \
+        for (p = 0; p < PX_COUNT; p++)                                                   \
+            checksum = (checksum ^ dst[p]) * 1099511628211ULL;                           \
+        printf("  %-14s %6.2f ns/frame\n", name, secs * 1e9 / rounds);                  \
+    } while (0)
+
+static int bench_pixels(int argc, char *argv[])
+{
+    uint16_t a[PX_COUNT], b[PX_COUNT], dst[PX_COUNT];
+    uint64_t checksum = 1469598103934665603ULL, glyph = ascii_letter['R'];
+    struct gamma_t dim;
+    unsigned long rounds = 10000000, i;
+    struct timespec start;
+    double secs;
+    int opt, p;
+
+    while ((opt = getopt(argc, argv, "n:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            rounds = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: bench pixels [-n rounds]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if (rounds == 0)
+        return EXIT_FAILURE;
+    for (p = 0; p < PX_COUNT; p++)
+    {
+        a[p] = (uint16_t)(p * 0x9E37 + 0x1234);
+        b[p] = (uint16_t)(p * 0x7F4A ^ 0xBEEF);
+    }
+    memset(dst, 0, sizeof(dst));
+
+#if PX_SSE2
+    printf("pixels: SSE2, %lu rounds\n", rounds);
+#elif PX_NEON
+    printf("pixels: NEON, %lu rounds\n", rounds);
+#else
+    printf("pixels: scalar, %lu rounds\n", rounds);
+#endif
+    PIXEL_BENCH("copy", px_copy(dst, a));
+    PIXEL_BENCH("fill", px_fill(dst, (uint16_t)i));
+    PIXEL_BENCH("glyph", px_glyph(dst, glyph ^ i, 0xF800, 0x001F));
+    PIXEL_BENCH("glyph_over", px_glyph_over(dst, glyph ^ i, 0x07E0));
+    PIXEL_BENCH("cells_over", px_cells_over(dst, glyph ^ i, 0xFFE0));
+    PIXEL_BENCH("scale", px_scale(dst, a, i & 0x1FF));
+    PIXEL_BENCH("fade", px_fade(dst, a, b, i & 0x1FF));
+    PIXEL_BENCH("shift_cols", px_shift_cols(dst, b, (int)(i % 17) - 8, 0x1234));
+    gamma_init(&dim, 96, 2.2f, 1);
+    PIXEL_BENCH("gamma_dither", gamma_apply(&dim, dst, a, i));
+    printf("  checksum %016llx\n", (unsigned long long)checksum);
+    return 0;
+}
+
+//code frames, decode them back rounds times and report the sizes and rates
+static int codec_run(const char *name, const uint16_t *frames, unsigned long count, unsigned long rounds,
+                     uint64_t *checksum)
+{
+    uint8_t *stream = malloc(count * ANIM_FRAME_MAX);
+    uint16_t prev[PX_COUNT], pixel[PX_COUNT];
+    unsigned long i, r, kinds[3] = {0}, bad = 0;
+    size_t len = 0, at;
+    struct timespec start;
+    double enc, dec;
+    int n;
+
+    if (stream == NULL)
+        return -1;
+    px_fill(prev, 0);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < count; i++)
+    {
+        len += anim_encode(stream + len, i ? frames + (i - 1) * PX_COUNT : prev, frames + i * PX_COUNT, 100);
+        __asm__ volatile("" : : "r"(stream) : "memory");
+    }
+    enc = elapsed(&start);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (r = 0; r < rounds; r++)
+    {
+        px_fill(pixel, 0);
+        for (i = 0, at = 0; i < count; i++, at += n)
+        {
+            n = anim_decode(stream + at, len - at, pixel, NULL);
+            if (n <= 0)
+                break;
+            //the first round checks every frame, the rest are timed as they are
+            if (r == 0)
+            {
+                kinds[stream[at]]++;
+                bad += memcmp(pixel, frames + i * PX_COUNT, sizeof(pixel)) != 0;
+            }
+            __asm__ volatile("" : : "r"(pixel) : "memory");
+        }
+        if (i != count)
+            bad++;
+    }
+    dec = elapsed(&start);
+
+    for (at = 0; at < len; at++)
+        *checksum = (*checksum ^ stream[at]) * 1099511628211ULL;
+    printf("  %-6s %7.1f bytes/frame (%4.1f%% of raw)  same/mask/rle %lu/%lu/%lu  encode %6.1f ns  decode %6.1f ns%s\n",
+           name, (double)len / count, 100.0 * len / (count * 2 * PX_COUNT), kinds[ANIM_SAME], kinds[ANIM_MASK],
+           kinds[ANIM_RLE], enc * 1e9 / count, dec * 1e9 / (count * rounds), bad ? "  MISMATCH" : "");
+    free(stream);
+    return bad ? -1 : 0;
+}
+
+static int bench_codec(int argc, char *argv[])
+{
+    static const char text[] = "The quick brown fox jumps over the lazy dog 0123456789 ";
+    static const uint16_t pal[2] = {0x0000, 0xFFE0};
+    uint64_t checksum = 1469598103934665603ULL, rng = 1;
+    unsigned long count = 10000, rounds = 20, i;
+    uint16_t *frames, a[PX_COUNT], b[PX_COUNT];
+    struct snake_game_t game;
+    struct frame_t frame;
+    struct fb_t dev;
+    struct marquee_t m;
+    size_t t = 1;
+    int opt, p, fail = 0;
+
+    while ((opt = getopt(argc, argv, "n:r:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            count = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            rounds = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: bench codec [-n frames] [-r rounds]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if (count == 0 || rounds == 0)
+        return EXIT_FAILURE;
+    frames = malloc(count * sizeof(a));
+    if (frames == NULL)
+        return EXIT_FAILURE;
+    printf("codec: %lu frames, %lu decode rounds, raw %zu bytes/frame\n", count, rounds, sizeof(a));
+
+    //proportional text scrolling one column a frame
+    marquee_start(&m, text[0], MARQUEE_PROPORTIONAL);
+    for (i = 0; i < count; i++)
+    {
+        while (marquee_step(&m))
+        {
+            marquee_feed(&m, ascii_letter[(unsigned char)text[t]]);
+            t = (t + 1) % (sizeof(text) - 1);
+        }
+        marquee_frame(&m, frames + i * PX_COUNT, pal);
+    }
+    fail |= codec_run("text", frames, count, rounds, &checksum);
+
+    //autoplayer games, a frame a move
+    frame_init(&frame, &dev);
+    snake_seed(&game, 1);
+    reset(&game);
+    for (i = 0; i < count; i++)
+    {
+        change_dir(&game, snake_ai_key(&game));
+        snake_step(&game);
+        snake_render(&frame, &game);
+        px_copy(frames + i * PX_COUNT, frame_pixels(&frame));
+    }
+    fail |= codec_run("snake", frames, count, rounds, &checksum);
+
+    //cross fades between random pictures, every pixel changes every frame
+    for (i = 0; i < count; i++)
+    {
+        if (i % 32 == 0)
+        {
+            for (p = 0; p < PX_COUNT; p++)
+            {
+                a[p] = i ? b[p] : 0;
+                b[p] = (uint16_t)snake_rand_next(&rng);
+            }
+        }
+        px_fade(frames + i * PX_COUNT, a, b, (i % 32 + 1) * 8);
+    }
+    fail |= codec_run("fade", frames, count, rounds, &checksum);
+
+    printf("  checksum %016llx\n", (unsigned long long)checksum);
+    free(frames);
+    return fail ? EXIT_FAILURE : 0;
+}
+
+#define BENCH_SOCK "unix:/dev/shm/rpic-bench.sock"
+
+struct net_rx_t
+{
+    struct netframe_receiver_t rx;
+    unsigned loss; //percent of frame packets thrown away before the end marker
+    unsigned seed;
+};
+
+//receive until the sender has been quiet for the socket timeout
+static void *net_receive(void *arg)
+{
+    struct net_rx_t *r = arg;
+    struct netframe_hdr_t h;
+
+    for (;;)
+    {
+        //the end marker counts as bad, everything after it must arrive
+        if (r->loss && r->rx.bad == 0 && recv(r->rx.fd, &h, sizeof(h), MSG_PEEK) == sizeof(h) &&
+            memcmp(h.magic, NETFRAME_MAGIC, 2) == 0 && (unsigned)rand_r(&r->seed) % 100 < r->loss)
+        {
+            netframe_discard(&r->rx);
+            continue;
+        }
+        if (netframe_receive(&r->rx) < 0 && errno != EINTR)
+            return NULL;
+    }
+}
+
+static int bench_net(int argc, char *argv[])
+{
+    static const char text[] = "The quick brown fox jumps over the lazy dog 0123456789 ";
+    static const uint16_t pal[2] = {0x0000, 0xFFE0};
+    struct timeval timeout = {0, 200000};
+    struct netframe_sender_t sender;
+    struct canvas_marquee_t cm;
+    struct canvas_t canvas;
+    struct net_rx_t r;
+    struct timespec start;
+    pthread_t thread;
+    uint16_t *screens, **fb;
+    unsigned long count = 2000, i, wrong = 0;
+    unsigned tiles = 16, t;
+    size_t next = 1;
+    double secs;
+    int opt;
+
+    memset(&r, 0, sizeof(r));
+    r.seed = 1;
+    while ((opt = getopt(argc, argv, "n:t:l:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            count = strtoul(optarg, NULL, 10);
+            break;
+        case 't':
+            tiles = strtoul(optarg, NULL, 10);
+            break;
+        case 'l':
+            r.loss = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: bench net [-n frames] [-t tiles] [-l loss_percent]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if (count == 0 || tiles == 0 || tiles > UINT16_MAX + 1 || r.loss > 100)
+        return EXIT_FAILURE;
+
+    //the receiver's panels are plain memory here, the sender's canvas has none at all
+    screens = calloc(tiles, FRAME_BYTES);
+    fb = malloc(tiles * sizeof(*fb));
+    if (screens == NULL || fb == NULL || canvas_init(&canvas, tiles, 1) < 0)
+        return EXIT_FAILURE;
+    for (t = 0; t < tiles; t++)
+        fb[t] = screens + t * PX_COUNT;
+    if (netframe_receiver_open(&r.rx, BENCH_SOCK, 0, tiles, fb) < 0 ||
+        netframe_sender_open(&sender, BENCH_SOCK, tiles) < 0)
+    {
+        perror(BENCH_SOCK);
+        return EXIT_FAILURE;
+    }
+    setsockopt(r.rx.fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    canvas.remote = netframe_canvas_send;
+    canvas.remote_ctx = &sender;
+    pthread_create(&thread, NULL, net_receive, &r);
+
+    //text scrolling across the whole wall, a flush a column
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    canvas_marquee_start(&cm, &canvas, text[0], MARQUEE_PROPORTIONAL, pal);
+    for (i = 0; i < count; i++)
+    {
+        while (canvas_marquee_step(&cm, &canvas))
+        {
+            canvas_marquee_feed(&cm, &canvas, ascii_letter[(unsigned char)text[next]]);
+            next = (next + 1) % (sizeof(text) - 1);
+        }
+        canvas_flush(&canvas);
+    }
+    secs = elapsed(&start);
+
+    //end marker, then every tile again in full so the last frame is whole whatever was lost
+    sendto(sender.fd, "end", 3, 0, (struct sockaddr *)&sender.to.sa, sender.to.len);
+    netframe_rekey(&sender);
+    memset(canvas.dirty, 1, tiles);
+    canvas_flush(&canvas);
+    pthread_join(thread, NULL);
+
+    for (t = 0; t < tiles; t++)
+        wrong += memcmp(fb[t], frame_pixels(&canvas.tile[t]), FRAME_BYTES) != 0;
+
+    printf("net: %lu frames over %u tiles, %u%% loss\n", count, tiles, r.loss);
+    printf("  %.3f s, %.0f frames/s, %.0f packets/s, %.1f us a flush\n", secs, count / secs,
+           sender.packets / secs, secs * 1e6 / count);
+    printf("  %lu packets, %lu full, %.1f bytes/packet against %zu raw\n", sender.packets, sender.keys,
+           (double)sender.bytes / sender.packets, sizeof(struct netframe_hdr_t) + FRAME_BYTES);
+    printf("  received %lu full, %lu delta, %lu stale, %lu after a gap, %lu bad\n", r.rx.fulls, r.rx.deltas,
+           r.rx.stale, r.rx.gaps, r.rx.bad);
+    printf("  %s\n", wrong ? "MISMATCH on the receiving panels" : "receiving panels match");
+
+    netframe_sender_close(&sender);
+    netframe_receiver_close(&r.rx);
+    canvas_free(&canvas);
+    free(fb);
+    free(screens);
+    return wrong ? EXIT_FAILURE : 0;
+}
+
+#define BENCH_RING "/dev/shm/rpic-bench-ring"
+
+struct ring_producer_t
+{
+    pthread_t thread;
+    unsigned long frames;
+    unsigned long busy;
+    atomic_int *running;
+};
+
+//frames of one value each, so a frame mixing two submissions shows up
+static void *ring_produce(void *arg)
+{
+    struct ring_producer_t *p = arg;
+    struct frame_ring_t r;
+    uint64_t n;
+    uint16_t *slot;
+    int i;
+
+    if (ring_attach(&r, BENCH_RING) < 0)
+        return NULL;
+    while (atomic_load(p->running))
+    {
+        slot = ring_begin(&r, &n);
+        for (i = 0; i < PX_COUNT; i++)
+            slot[i] = (uint16_t)n;
+        ring_publish(&r, n);
+        p->frames++;
+    }
+    p->busy = r.busy;
+    ring_detach(&r);
+    return NULL;
+}
+
+static int bench_ring(int argc, char *argv[])
+{
+    struct ring_producer_t *producers;
+    struct frame_ring_t ring;
+    struct timespec start;
+    atomic_int running = 1;
+    uint16_t pixel[PX_COUNT];
+    unsigned long taken = 0, mixed = 0, written = 0, busy = 0;
+    unsigned threads = 2, i;
+    double secs = 2;
+    int opt, p;
+
+    while ((opt = getopt(argc, argv, "s:j:")) != -1)
+    {
+        switch (opt)
+        {
+        case 's':
+            secs = strtod(optarg, NULL);
+            break;
+        case 'j':
+            threads = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: bench ring [-s seconds] [-j producers]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if (secs <= 0 || threads == 0)
+        return EXIT_FAILURE;
+    producers = calloc(threads, sizeof(*producers));
+    if (producers == NULL || ring_create(&ring, BENCH_RING) < 0)
+    {
+        perror(BENCH_RING);
+        return EXIT_FAILURE;
+    }
+    for (i = 0; i < threads; i++)
+    {
+        producers[i].running = &running;
+        pthread_create(&producers[i].thread, NULL, ring_produce, &producers[i]);
+    }
+
+    //the compositor side flat out instead of once a tick, to hit as many races as it can
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (elapsed(&start) < secs)
+    {
+        if (!ring_take(&ring, pixel))
+            continue;
+        taken++;
+        for (p = 1; p < PX_COUNT; p++)
+            mixed += pixel[p] != pixel[0];
+    }
+    atomic_store(&running, 0);
+    for (i = 0; i < threads; i++)
+    {
+        pthread_join(producers[i].thread, NULL);
+        written += producers[i].frames;
+        busy += producers[i].busy;
+    }
+
+    printf("ring: %u producers, %d slots\n", threads, RING_SLOTS);
+    printf("  %lu frames taken in %.1f s, %lu submitted, one every %.0f ns\n", taken, secs, written,
+           secs * 1e9 / written);
+    printf("  %lu copies thrown away as torn, %lu busy slots passed over\n", ring.torn, busy);
+    printf("  %s\n", mixed ? "MIXED frames reached the compositor" : "every frame taken was whole");
+
+    ring_detach(&ring);
+    unlink(BENCH_RING);
+    free(producers);
+    return mixed ? EXIT_FAILURE : 0;
+}
+
+static const unsigned int turn_keys[4] = {KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT};
+
+//random walk policy for the batch benchmark, a quarter of the ticks turn
+static inline int random_turn(uint64_t *rng, unsigned int *code)
+{
+    if (snake_rand_next(rng) % 4 != 0)
+        return 0;
+    *code = turn_keys[snake_rand_next(rng) % 4];
+    return 1;
+}
+
+//random_turn() on every lane, the second draw is only kept in the lanes that turn
+static inline void random_turns(snake_bits_t *rng, snake_lanes_t *codes)
+{
+    snake_bits_t keep = *rng, first, second;
+    snake_lanes_t turn, k;
+
+    snake_lanes_rand(&keep, &first);
+    *rng = keep;
+    snake_lanes_rand(rng, &second);
+    turn = SNAKE_NARROW((first & 3) == 0);
+    *rng = SNAKE_LANES_BLEND(SNAKE_WIDEN(turn), *rng, keep);
+    k = SNAKE_NARROW(second & 3);
+    *codes = turn & (((k == 0) & KEY_UP) | ((k == 1) & KEY_RIGHT) | ((k == 2) & KEY_DOWN) | ((k == 3) & KEY_LEFT));
+}
+
+//everything the scalar engine looks at, the body only where it is alive
+static int same_game(const struct snake_game_t *a, const struct snake_game_t *b)
+{
+    unsigned i;
+
+    if (a->snake.x != b->snake.x || a->snake.y != b->snake.y ||
+        a->snake.heading != b->snake.heading || a->snake.length != b->snake.length ||
+        a->snake.tail != b->snake.tail || a->snake.crashed != b->snake.crashed ||
+        a->snake.occupied != b->snake.occupied || a->apple.x != b->apple.x ||
+        a->apple.y != b->apple.y || a->rng != b->rng)
+        return 0;
+    for (i = 0; i < a->snake.length; i++)
+    {
+        if (snake_cell(a, i) != snake_cell(b, i))
+            return 0;
+    }
+    return 1;
+}
+
+static int bench_batch(int argc, char *argv[])
+{
+    struct snake_game_t *games, check;
+    struct snake_batch_t *batches;
+    snake_lanes_t codes;
+    snake_bits_t *batch_turns;
+    uint64_t *turns;
+    unsigned long boards = 4096, ticks = 10000, verify, t, i, scalar_rounds = 0, batch_rounds = 0;
+    unsigned long nb, mismatches = 0;
+    unsigned int seed = 1, code;
+    struct timespec start;
+    double scalar_secs, batch_secs;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:t:r:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            boards = strtoul(optarg, NULL, 10);
+            break;
+        case 't':
+            ticks = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            seed = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: bench batch [-n boards] [-t ticks] [-r seed]\n");
+            return EXIT_FAILURE;
+        }
+    }
+    nb = (boards + SNAKE_LANES - 1) / SNAKE_LANES;
+    boards = nb * SNAKE_LANES;
+    if (boards == 0 || ticks == 0)
+        return EXIT_FAILURE;
+
+    games = malloc(boards * sizeof(*games));
+    turns = malloc(boards * sizeof(*turns));
+    batch_turns = aligned_alloc(64, nb * sizeof(*batch_turns));
+    batches = aligned_alloc(64, nb * sizeof(*batches));
+    if (games == NULL || turns == NULL || batch_turns == NULL || batches == NULL)
+    {
+        perror("bench batch");
+        return EXIT_FAILURE;
+    }
+    for (i = 0; i < boards; i++)
+    {
+        snake_seed(&games[i], (uint64_t)seed << 32 | i);
+        reset(&games[i]);
+        snake_batch_load(&batches[i / SNAKE_LANES], i % SNAKE_LANES, &games[i]);
+        turns[i] = batch_turns[i / SNAKE_LANES][i % SNAKE_LANES] = (uint64_t)i << 32 | seed | 1;
+    }
+
+    //lockstep over the first ticks, every lane must match its scalar twin after every step
+    verify = ticks < 1000 ? ticks : 1000;
+    for (t = 0; t < verify; t++)
+    {
+        for (i = 0; i < boards; i++)
+        {
+            if (random_turn(&turns[i], &code))
+                change_dir(&games[i], code);
+            scalar_rounds += snake_step(&games[i]);
+        }
+        for (i = 0; i < nb; i++)
+        {
+            random_turns(&batch_turns[i], &codes);
+            snake_batch_turns(&batches[i], &codes);
+            batch_rounds += snake_batch_step(&batches[i]);
+        }
+        for (i = 0; i < boards; i++)
+        {
+            snake_batch_store(&batches[i / SNAKE_LANES], i % SNAKE_LANES, &check);
+            mismatches += !same_game(&games[i], &check);
+        }
+    }
+
+    //then the rest of the ticks timed, each path on its own
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (t = verify; t < ticks; t++)
+    {
+        for (i = 0; i < boards; i++)
+        {
+            if (random_turn(&turns[i], &code))
+                change_dir(&games[i], code);
+            scalar_rounds += snake_step(&games[i]);
+        }
+    }
+    scalar_secs = elapsed(&start);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (t = verify; t < ticks; t++)
+    {
+        for (i = 0; i < nb; i++)
+        {
+            random_turns(&batch_turns[i], &codes);
+            snake_batch_turns(&batches[i], &codes);
+            batch_rounds += snake_batch_step(&batches[i]);
+        }
+    }
+    batch_secs = elapsed(&start);
+
+    for (i = 0; i < boards; i++)
+    {
+        snake_batch_store(&batches[i / SNAKE_LANES], i % SNAKE_LANES, &check);
+        mismatches += !same_game(&games[i], &check);
+    }
+    mismatches += scalar_rounds != batch_rounds;
+
+    printf("batch: %lu boards x %lu ticks, %u lanes\n", boards, ticks, SNAKE_LANES);
+    if (ticks > verify)
+    {
+        printf("  scalar %.3f s, %.0f board steps/s\n", scalar_secs, boards * (ticks - verify) / scalar_secs);
+        printf("  batch  %.3f s, %.0f board steps/s, speedup %.2f\n", batch_secs,
+               boards * (ticks - verify) / batch_secs, scalar_secs / batch_secs);
+    }
+    printf("  %lu rounds, %s\n", batch_rounds, mismatches ? "MISMATCH against the scalar engine" : "bit-exact");
+
+    free(batches);
+    free(batch_turns);
+    free(turns);
+    free(games);
+    return mismatches ? EXIT_FAILURE : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc >= 2 && strcmp(argv[1], "snake") == 0)
+        return bench_snake(argc - 1, argv + 1);
+    if (argc >= 2 && strcmp(argv[1], "parallel") == 0)
+        return bench_parallel(argc - 1, argv + 1);
+    if (argc >= 2 && strcmp(argv[1], "batch") == 0)
+        return bench_batch(argc - 1, argv + 1);
+    if (argc >= 2 && strcmp(argv[1], "pixels") == 0)
+        return bench_pixels(argc - 1, argv + 1);
+    if (argc >= 2 && strcmp(argv[1], "codec") == 0)
+        return bench_codec(argc - 1, argv + 1);
+    if (argc >= 2 && strcmp(argv[1], "net") == 0)
+        return bench_net(argc - 1, argv + 1);
+    if (argc >= 2 && strcmp(argv[1], "ring") == 0)
+        return bench_ring(argc - 1, argv + 1);
+
+    fprintf(stderr, "usage: %s snake|parallel|batch|pixels|codec|net|ring [options]\n", argv[0]);
+    return EXIT_FAILURE;
+}
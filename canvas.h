@@ -0,0 +1,345 @@
+/*
+ *  Virtual canvas spanning a wall of 8x8 LED panels.
+ *
+ *  The canvas is one W x H RGB565 surface in row-major order, W and H
+ *  multiples of 8, cut into 8x8 tiles that each drive one panel through
+ *  its own struct frame_t. A panel is a mapped framebuffer, either a real
+ *  device or an emulator file. Drawing marks the tiles it touches and
+ *  canvas_flush() presents only those.
+ *
+ *  The helpers draw whole glyphs, blocks and bands rather than panels, so
+ *  a caller never loops over panels itself. canvas_board() scales an 8x8
+ *  surface up to fill the wall. struct canvas_marquee_t scrolls text
+ *  across the full width.
+ */
+#ifndef CANVAS_H
+#define CANVAS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "pixel_ops.h"
+#include "frame.h"
+#include "marquee.h"
+#include "gamma.h"
+#include "sense_hat.h"
+
+#define CANVAS_TILE 8
+#define CANVAS_WALL_ENV "SENSE_HAT_WALL" //printf pattern naming panel i, e.g. /dev/shm/wall%d
+
+struct canvas_t
+{
+    int w, h;         //pixels
+    int cols, rows;   //tiles
+    uint16_t *pixel;  //w * h
+    uint8_t *dirty;   //per tile
+    uint32_t *todo;   //dirty tiles gathered for a flush
+    struct frame_t *tile;
+    int *fd;          //per tile, -1 for a mapping the caller owns
+    //called after every flush with the tiles it presented, e.g. to send them to remote panels
+    void (*remote)(void *ctx, struct canvas_t *c, const uint32_t *tiles, uint32_t n);
+    void *remote_ctx;
+    const struct gamma_t *gamma; //brightness and gamma applied to every tile presented, or NULL
+    uint32_t frame;              //flushes so far, the dither phase
+};
+
+//allocate a cols x rows tile canvas with no panels attached yet, returns -1 without memory
+static inline int canvas_init(struct canvas_t *c, int cols, int rows)
+{
+    int i, n = cols * rows;
+
+    memset(c, 0, sizeof(*c));
+    if (cols < 1 || rows < 1)
+        return -1;
+    c->cols = cols;
+    c->rows = rows;
+    c->w = cols * CANVAS_TILE;
+    c->h = rows * CANVAS_TILE;
+    c->pixel = calloc((size_t)c->w * c->h, sizeof(*c->pixel));
+    c->dirty = calloc(n, sizeof(*c->dirty));
+    c->todo = calloc(n, sizeof(*c->todo));
+    c->tile = calloc(n, sizeof(*c->tile));
+    c->fd = malloc(n * sizeof(*c->fd));
+    if (c->pixel == NULL || c->dirty == NULL || c->todo == NULL || c->tile == NULL || c->fd == NULL)
+    {
+        free(c->pixel);
+        free(c->dirty);
+        free(c->todo);
+        free(c->tile);
+        free(c->fd);
+        return -1;
+    }
+    for (i = 0; i < n; i++)
+        c->fd[i] = -1;
+    return 0;
+}
+
+//drive tile i, counted row by row from the top left, from an already mapped framebuffer
+static inline void canvas_attach(struct canvas_t *c, int i, void *dev)
+{
+    frame_init(&c->tile[i], dev);
+}
+
+//map every tile from the path pattern names with its number plus first, a character
+//device as it is and anything else as an emulator file
+static inline int canvas_open_tiles(struct canvas_t *c, const char *pattern, int first)
+{
+    char path[256];
+    struct stat st;
+    void *map;
+    int i;
+
+    for (i = 0; i < c->cols * c->rows; i++)
+    {
+        snprintf(path, sizeof(path), pattern, first + i);
+        if (stat(path, &st) == 0 && S_ISCHR(st.st_mode))
+            c->fd[i] = open(path, O_RDWR | O_CLOEXEC);
+        else
+            c->fd[i] = emu_open_fb(path);
+        if (c->fd[i] < 0)
+        {
+            perror(path);
+            return -1;
+        }
+        map = mmap(NULL, SENSE_FB_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, c->fd[i], 0);
+        if (map == MAP_FAILED)
+        {
+            perror(path);
+            close(c->fd[i]);
+            c->fd[i] = -1;
+            return -1;
+        }
+        canvas_attach(c, i, map);
+    }
+    return 0;
+}
+
+//unmap the panels canvas_open_tiles() mapped and free the canvas
+static inline void canvas_free(struct canvas_t *c)
+{
+    int i;
+
+    for (i = 0; i < c->cols * c->rows; i++)
+    {
+        if (c->fd[i] < 0)
+            continue;
+        munmap(c->tile[i].dev, SENSE_FB_SIZE);
+        close(c->fd[i]);
+    }
+    free(c->pixel);
+    free(c->dirty);
+    free(c->todo);
+    free(c->tile);
+    free(c->fd);
+}
+
+//mark the tiles under the w x h rectangle at x, y for the next flush, clipped to the canvas
+static inline void canvas_mark(struct canvas_t *c, int x, int y, int w, int h)
+{
+    int tx, ty, x1 = x + w, y1 = y + h;
+
+    if (x < 0)
+        x = 0;
+    if (y < 0)
+        y = 0;
+    if (x1 > c->w)
+        x1 = c->w;
+    if (y1 > c->h)
+        y1 = c->h;
+    if (x >= x1 || y >= y1)
+        return;
+    for (ty = y / CANVAS_TILE; ty <= (y1 - 1) / CANVAS_TILE; ty++)
+    {
+        for (tx = x / CANVAS_TILE; tx <= (x1 - 1) / CANVAS_TILE; tx++)
+            c->dirty[ty * c->cols + tx] = 1;
+    }
+}
+
+static inline uint16_t *canvas_row(struct canvas_t *c, int y)
+{
+    return c->pixel + (size_t)y * c->w;
+}
+
+static inline void canvas_fill(struct canvas_t *c, uint16_t color)
+{
+    px_row_t v = px_splat(color);
+    size_t i, n = (size_t)c->w * c->h;
+
+    //w is a multiple of 8, so the canvas is a whole number of rows of eight
+    for (i = 0; i < n; i += 8)
+        px_store(c->pixel + i, v);
+    memset(c->dirty, 1, c->cols * c->rows);
+}
+
+//8x8 glyph in atlas order at x, y, which need not be on a tile boundary
+static inline void canvas_glyph(struct canvas_t *c, int x, int y, uint64_t glyph, uint16_t fg, uint16_t bg)
+{
+    px_row_t f = px_splat(fg), b = px_splat(bg);
+    int r;
+
+    for (r = 0; r < 8; r++)
+        px_store(canvas_row(c, y + r) + x, px_select(px_row_mask((glyph >> (56 - 8 * r)) & 0xFF, px_bits_msb), f, b));
+    canvas_mark(c, x, y, 8, 8);
+}
+
+//an 8x8 surface blown up to scale x scale blocks per pixel, top left at x, y
+static inline void canvas_blit_scaled(struct canvas_t *c, const uint16_t *src, int scale, int x, int y)
+{
+    uint16_t *row;
+    int sy, sx, k;
+
+    for (sy = 0; sy < 8; sy++)
+    {
+        row = canvas_row(c, y + sy * scale) + x;
+        if (scale == 1)
+        {
+            px_store(row, px_load(src + 8 * sy));
+            continue;
+        }
+        for (sx = 0; sx < 8; sx++)
+        {
+            for (k = 0; k < scale; k++)
+                row[sx * scale + k] = src[8 * sy + sx];
+        }
+        //the other rows of the block are copies of the first
+        for (k = 1; k < scale; k++)
+            memcpy(canvas_row(c, y + sy * scale + k) + x, row, 8 * scale * sizeof(*row));
+    }
+    canvas_mark(c, x, y, 8 * scale, 8 * scale);
+}
+
+//an 8x8 surface as large as the wall allows and centred, the rest black
+static inline void canvas_board(struct canvas_t *c, const uint16_t *src)
+{
+    int scale = (c->w < c->h ? c->w : c->h) / 8;
+
+    if (c->w != 8 * scale || c->h != 8 * scale)
+        canvas_fill(c, 0);
+    canvas_blit_scaled(c, src, scale, (c->w - 8 * scale) / 2, (c->h - 8 * scale) / 2);
+}
+
+//move the 8 row band at y one column left, the rightmost column keeps its old value
+static inline void canvas_band_left(struct canvas_t *c, int y)
+{
+    int r;
+
+    for (r = 0; r < 8; r++)
+        memmove(canvas_row(c, y + r), canvas_row(c, y + r) + 1, (c->w - 1) * sizeof(uint16_t));
+    canvas_mark(c, 0, y, c->w, 8);
+}
+
+//gather tile i from the canvas into its back buffer, corrected, and present it if it has a
+//panel here
+static inline void canvas_present_tile(struct canvas_t *c, uint32_t i)
+{
+    int tx = i % c->cols, ty = i / c->cols, r;
+    uint16_t *back = frame_pixels(&c->tile[i]);
+
+    for (r = 0; r < 8; r++)
+        px_store(back + 8 * r, px_load(canvas_row(c, ty * CANVAS_TILE + r) + tx * CANVAS_TILE));
+    if (c->gamma != NULL)
+        gamma_apply(c->gamma, back, back, c->frame);
+    if (c->tile[i].dev != NULL)
+        frame_present(&c->tile[i]);
+}
+
+//present every dirty tile, returns how many there were
+static inline unsigned canvas_flush(struct canvas_t *c)
+{
+    uint32_t i, n = 0;
+
+    for (i = 0; i < (uint32_t)(c->cols * c->rows); i++)
+    {
+        if (c->dirty[i])
+        {
+            c->todo[n++] = i;
+            c->dirty[i] = 0;
+        }
+    }
+    for (i = 0; i < n; i++)
+        canvas_present_tile(c, c->todo[i]);
+    if (c->remote != NULL)
+        c->remote(c->remote_ctx, c, c->todo, n);
+    c->frame++;
+    return n;
+}
+
+//present every tile again, after the correction changed or to move the dither pattern on
+static inline unsigned canvas_refresh(struct canvas_t *c)
+{
+    memset(c->dirty, 1, c->cols * c->rows);
+    return canvas_flush(c);
+}
+
+//text scrolling across the whole width of the canvas, on the 8 row band in the middle;
+//the band's rightmost 8 columns always hold the marquee window
+struct canvas_marquee_t
+{
+    struct marquee_t m;
+    int y;
+    int tail; //blank glyphs still to scroll in once the text is done, to clear the wall
+    uint16_t fg, bg;
+};
+
+static inline void canvas_marquee_draw(struct canvas_marquee_t *cm, struct canvas_t *c)
+{
+    canvas_glyph(c, c->w - 8, cm->y, cm->m.win, cm->fg, cm->bg);
+}
+
+//blank the band and put c at its right end
+static inline void canvas_marquee_start(struct canvas_marquee_t *cm, struct canvas_t *c, unsigned char ch,
+                                        int proportional, const uint16_t *pal)
+{
+    int r, x;
+
+    cm->y = (c->h - 8) / 2 / 8 * 8;
+    cm->tail = 0;
+    cm->fg = pal[1];
+    cm->bg = pal[0];
+    for (r = 0; r < 8; r++)
+    {
+        for (x = 0; x < c->w; x += 8)
+            px_store(canvas_row(c, cm->y + r) + x, px_splat(cm->bg));
+    }
+    canvas_mark(c, 0, cm->y, c->w, 8);
+    marquee_start(&cm->m, ch, proportional);
+    canvas_marquee_draw(cm, c);
+}
+
+static inline void canvas_marquee_feed(struct canvas_marquee_t *cm, struct canvas_t *c, uint64_t glyph)
+{
+    marquee_feed(&cm->m, glyph);
+    canvas_marquee_draw(cm, c);
+}
+
+//end of text, scroll blank in until the last letter has left the left edge
+static inline void canvas_marquee_flush(struct canvas_marquee_t *cm, struct canvas_t *c)
+{
+    cm->tail = c->cols - 1;
+    marquee_flush(&cm->m);
+    canvas_marquee_draw(cm, c);
+}
+
+//scroll one column, returns 1 when the next glyph is due, or after a flush when the wall is clear
+static inline int canvas_marquee_step(struct canvas_marquee_t *cm, struct canvas_t *c)
+{
+    int due = marquee_step(&cm->m);
+
+    canvas_band_left(c, cm->y);
+    canvas_marquee_draw(cm, c);
+    if (due && cm->tail > 0)
+    {
+        cm->tail--;
+        marquee_flush(&cm->m);
+        return 0;
+    }
+    return due;
+}
+
+#endif
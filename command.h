@@ -0,0 +1,136 @@
+/*
+ *  Line-oriented command input for an epoll loop.
+ *
+ *  The descriptor is left blocking: stdin is shared with the shell, which
+ *  would inherit a non-blocking terminal from a program killed before it
+ *  could put the flag back. Instead the caller reads with one
+ *  cmd_reader_fill() each time epoll reports the descriptor ready, which
+ *  cannot block, and then takes the whole lines buffered so far with
+ *  cmd_read_line(), never waiting for the rest of one. A terminal, a pipe
+ *  or a script file all work, and many lines arriving at once are handed
+ *  out one after another. Overlong lines are dropped whole.
+ *
+ *  A command table maps the first word of a line to a handler that gets
+ *  the rest of the line. Blank lines and lines starting with # are skipped.
+ */
+#ifndef COMMAND_H
+#define COMMAND_H
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+
+#define CMD_LINE_MAX 256
+
+struct cmd_reader_t
+{
+    int fd;
+    int eof;
+    int overflow; //dropping the rest of an overlong line
+    size_t len;
+    char buf[CMD_LINE_MAX];
+};
+
+struct cmd_t
+{
+    const char *name;
+    const char *usage;                  //arguments, for help and errors
+    int (*run)(void *ctx, char *args);  //returns -1 for bad arguments
+};
+
+static inline void cmd_reader_init(struct cmd_reader_t *r, int fd)
+{
+    r->fd = fd;
+    r->eof = 0;
+    r->overflow = 0;
+    r->len = 0;
+}
+
+//one read() into the buffer, for when the descriptor is ready or a plain file that always
+//is; returns -1 once the input has ended
+static inline int cmd_reader_fill(struct cmd_reader_t *r)
+{
+    ssize_t got;
+
+    if (r->eof)
+        return -1;
+    //a buffer full of one unfinished line is dropped, and the rest of it as it arrives
+    if (r->len == sizeof(r->buf))
+    {
+        r->overflow = 1;
+        r->len = 0;
+    }
+    got = read(r->fd, r->buf + r->len, sizeof(r->buf) - r->len);
+    if (got > 0)
+        r->len += got;
+    else if (got == 0 || (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK))
+        r->eof = 1;
+    return r->eof ? -1 : 0;
+}
+
+//copy the next whole line read so far into line, CMD_LINE_MAX bytes, without its newline;
+//returns 1 for a line, 0 when none is complete yet, -1 once the input has ended
+static inline int cmd_read_line(struct cmd_reader_t *r, char *line)
+{
+    char *nl;
+    size_t n;
+
+    for (;;)
+    {
+        nl = memchr(r->buf, '\n', r->len);
+        //a last line without a newline still counts
+        if (nl == NULL && r->eof && r->len > 0)
+            nl = r->buf + r->len;
+        if (nl == NULL)
+            return r->eof ? -1 : 0;
+        n = nl - r->buf;
+        memcpy(line, r->buf, n);
+        line[n] = '\0';
+        n = n < r->len ? n + 1 : n;
+        memmove(r->buf, r->buf + n, r->len - n);
+        r->len -= n;
+        if (!r->overflow)
+            return 1;
+        r->overflow = 0;
+    }
+}
+
+//run the command on line; returns its result, 0 for a blank line, -1 when unknown
+static inline int cmd_dispatch(const struct cmd_t *table, void *ctx, char *line)
+{
+    char *name, *args;
+    int ret;
+
+    for (name = line; isspace((unsigned char)*name); name++)
+        ;
+    if (*name == '\0' || *name == '#')
+        return 0;
+    for (args = name; *args != '\0' && !isspace((unsigned char)*args); args++)
+        ;
+    if (*args != '\0')
+        *args++ = '\0';
+    while (isspace((unsigned char)*args))
+        args++;
+
+    for (; table->name != NULL; table++)
+    {
+        if (strcmp(table->name, name) != 0)
+            continue;
+        ret = table->run(ctx, args);
+        if (ret < 0)
+            fprintf(stderr, "usage: %s %s\n", table->name, table->usage);
+        return ret;
+    }
+    fprintf(stderr, "unknown command %s, try help\n", name);
+    return -1;
+}
+
+static inline void cmd_help(const struct cmd_t *table, FILE *out)
+{
+    for (; table->name != NULL; table++)
+        fprintf(out, "  %s %s\n", table->name, table->usage);
+}
+
+#endif
@@ -0,0 +1,192 @@
+/*
+ *  Layered compositor for 8x8 surfaces.
+ *
+ *  A layer is an 8x8 picture with a coverage mask, the pixels it paints
+ *  (bit i is pixel i, the snake engine's cell order), an opacity out of
+ *  256 and a z order; higher z sits on top. Layers are stacked over black
+ *  from the lowest z up, each covered pixel mixed over what is below it
+ *  by the layer's opacity.
+ *
+ *  Every change to a layer adds the pixels it affects to the damage mask,
+ *  and comp_compose() rebuilds only the rows that hold damage, or nothing
+ *  at all when no layer changed since the last call. Rows are blended a
+ *  whole row at a time with the pixel_ops.h vector primitives.
+ */
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "pixel_ops.h"
+
+#define COMP_LAYERS 8
+#define COMP_OPAQUE 256
+#define COMP_ALL (~(uint64_t)0)
+
+struct comp_layer_t
+{
+    uint16_t pixel[PX_COUNT];
+    uint64_t cover;   //pixels this layer paints
+    unsigned opacity; //0 - COMP_OPAQUE
+    int z;
+    int visible;
+};
+
+struct compositor_t
+{
+    struct comp_layer_t layer[COMP_LAYERS];
+    uint8_t order[COMP_LAYERS]; //layer ids from the bottom up
+    unsigned count;
+    uint64_t damage;            //pixels to rebuild at the next compose
+    uint16_t out[PX_COUNT];
+    unsigned long composed, skipped;
+};
+
+static inline void comp_init(struct compositor_t *c)
+{
+    memset(c, 0, sizeof(*c));
+}
+
+//pixels a visible layer shows, which is what changing it can affect
+static inline uint64_t comp_shown(const struct comp_layer_t *l)
+{
+    return l->visible && l->opacity ? l->cover : 0;
+}
+
+//keep order sorted by z, layers of equal z in the order they were added
+static inline void comp_sort(struct compositor_t *c)
+{
+    unsigned i, j;
+    uint8_t id;
+
+    for (i = 1; i < c->count; i++)
+    {
+        id = c->order[i];
+        for (j = i; j > 0 && c->layer[c->order[j - 1]].z > c->layer[id].z; j--)
+            c->order[j] = c->order[j - 1];
+        c->order[j] = id;
+    }
+}
+
+//new empty, hidden layer at z, returns its id or -1 when all are taken
+static inline int comp_add(struct compositor_t *c, int z, unsigned opacity)
+{
+    struct comp_layer_t *l;
+
+    if (c->count == COMP_LAYERS)
+        return -1;
+    l = &c->layer[c->count];
+    memset(l, 0, sizeof(*l));
+    l->z = z;
+    l->opacity = opacity > COMP_OPAQUE ? COMP_OPAQUE : opacity;
+    c->order[c->count] = c->count;
+    c->count++;
+    comp_sort(c);
+    return c->count - 1;
+}
+
+static inline void comp_show(struct compositor_t *c, int id, int visible)
+{
+    struct comp_layer_t *l = &c->layer[id];
+
+    if (l->visible == !!visible)
+        return;
+    c->damage |= l->cover;
+    l->visible = !!visible;
+}
+
+static inline void comp_opacity(struct compositor_t *c, int id, unsigned opacity)
+{
+    struct comp_layer_t *l = &c->layer[id];
+
+    if (opacity > COMP_OPAQUE)
+        opacity = COMP_OPAQUE;
+    if (l->opacity == opacity)
+        return;
+    l->opacity = opacity;
+    c->damage |= l->visible ? l->cover : 0;
+}
+
+static inline void comp_z(struct compositor_t *c, int id, int z)
+{
+    if (c->layer[id].z == z)
+        return;
+    c->layer[id].z = z;
+    c->damage |= comp_shown(&c->layer[id]);
+    comp_sort(c);
+}
+
+//replace what the layer paints with the pixels of src under cover; only pixels that
+//actually change are damaged
+static inline void comp_draw(struct compositor_t *c, int id, const uint16_t *src, uint64_t cover)
+{
+    struct comp_layer_t *l = &c->layer[id];
+    uint64_t changed = l->cover ^ cover, both = l->cover & cover;
+    int i;
+
+    for (i = 0; i < PX_COUNT; i++)
+        changed |= (uint64_t)(both >> i & 1 && l->pixel[i] != src[i]) << i;
+    if (changed == 0)
+        return;
+    px_copy(l->pixel, src);
+    l->cover = cover;
+    if (l->visible && l->opacity)
+        c->damage |= changed;
+}
+
+//the whole frame is rebuilt at the next compose, e.g. after something else drew over it
+static inline void comp_damage_all(struct compositor_t *c)
+{
+    c->damage = COMP_ALL;
+}
+
+//rebuild the damaged rows of out; returns 0 when nothing changed, so there is nothing to show
+static inline int comp_compose(struct compositor_t *c)
+{
+    const struct comp_layer_t *l;
+    px_row_t acc, top, mask;
+    unsigned i, rowbits;
+    int r;
+
+    if (c->damage == 0)
+    {
+        c->skipped++;
+        return 0;
+    }
+    for (r = 0; r < PX_ROWS; r++)
+    {
+        if (((c->damage >> 8 * r) & 0xFF) == 0)
+            continue;
+        acc = px_splat(0);
+        for (i = 0; i < c->count; i++)
+        {
+            l = &c->layer[c->order[i]];
+            rowbits = (comp_shown(l) >> 8 * r) & 0xFF;
+            if (rowbits == 0)
+                continue;
+            top = px_load(l->pixel + 8 * r);
+            if (l->opacity < COMP_OPAQUE)
+                top = px_mix_row(acc, top, px_splat(COMP_OPAQUE - l->opacity), px_splat(l->opacity));
+            mask = px_row_mask(rowbits, px_bits_lsb);
+            acc = px_select(mask, top, acc);
+        }
+        px_store(c->out + 8 * r, acc);
+    }
+    c->damage = 0;
+    c->composed++;
+    return 1;
+}
+
+//coverage of the lit pixels of a glyph in atlas order, where pixel i is bit 63 - i
+static inline uint64_t comp_glyph_cover(uint64_t glyph)
+{
+    uint64_t cover = 0;
+    int i;
+
+    for (i = 0; i < PX_COUNT; i++)
+        cover |= (glyph >> (63 - i) & 1) << i;
+    return cover;
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ *  Double-buffered presentation for the 8x8 LED framebuffer.
+ *
+ *  Everything draws into the off-screen back buffer. frame_present() then
+ *  compares it with the last frame it put on the device and writes only
+ *  the 8-byte words that changed, or the whole frame in one copy when
+ *  most of it did. The device never sees an intermediate cleared frame.
+ */
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "pixel_ops.h"
+
+#define FRAME_WORDS 64
+#define FRAME_BYTES (FRAME_WORDS * sizeof(uint16_t))
+#define FRAME_CHUNK 4 //pixels compared and written together, 8 bytes
+
+struct fb_t
+{
+    uint16_t pixel[8][8];
+};
+
+struct frame_t
+{
+    struct fb_t *dev;  //mmapped LED framebuffer, only written by frame_present()
+    struct fb_t back;  //off-screen frame everything draws into
+    struct fb_t shown; //copy of what dev currently holds
+};
+
+//attach to a mapped device and blank it
+static inline void frame_init(struct frame_t *f, void *dev)
+{
+    f->dev = dev;
+    memset(&f->back, 0, FRAME_BYTES);
+    memset(&f->shown, 0, FRAME_BYTES);
+    memset(f->dev, 0, FRAME_BYTES);
+}
+
+//pixel i of the back buffer in row-major order, the layout glyphs and saves use
+static inline uint16_t *frame_pixels(struct frame_t *f)
+{
+    return &f->back.pixel[0][0];
+}
+
+static inline void frame_clear(struct frame_t *f)
+{
+    px_fill(frame_pixels(f), 0);
+}
+
+//push the back buffer to the device, returns how many 8-byte words differed
+static inline int frame_present(struct frame_t *f)
+{
+    const uint16_t *back = &f->back.pixel[0][0];
+    uint16_t *shown = &f->shown.pixel[0][0];
+    uint16_t *dev = &f->dev->pixel[0][0];
+    uint8_t dirty[FRAME_WORDS / FRAME_CHUNK];
+    int i, n = 0;
+
+    for (i = 0; i < FRAME_WORDS; i += FRAME_CHUNK)
+    {
+        dirty[i / FRAME_CHUNK] = memcmp(back + i, shown + i, FRAME_CHUNK * sizeof(uint16_t)) != 0;
+        n += dirty[i / FRAME_CHUNK];
+    }
+    if (n == 0)
+        return 0;
+
+    if (n > FRAME_WORDS / FRAME_CHUNK / 2)
+    {
+        px_copy(dev, back);
+    }
+    else
+    {
+        for (i = 0; i < FRAME_WORDS; i += FRAME_CHUNK)
+        {
+            if (dirty[i / FRAME_CHUNK])
+                memcpy(dev + i, back + i, FRAME_CHUNK * sizeof(uint16_t));
+        }
+    }
+    px_copy(shown, back);
+    return n;
+}
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ *  Shared-memory frame ring for putting pixels on the display from other
+ *  processes.
+ *
+ *  The display program creates the ring, a file in /dev/shm holding a
+ *  small header, one sequence word per slot and RING_SLOTS 128-byte frame
+ *  slots. A producer maps the same file and submits whole 8x8 frames with
+ *  plain stores: no syscall per frame, no access to the framebuffer. At
+ *  every tick the compositor takes the newest complete frame, if there is
+ *  one it has not shown yet.
+ *
+ *  Each slot is a seqlock. A producer takes the next frame number n from
+ *  the shared head, claims slot n % slots by setting its sequence word to
+ *  2n + 1, writes the pixels, and publishes with 2n + 2. A slot is only
+ *  claimed while its word is older than that, so a producer that stalled
+ *  after taking n never overwrites a later frame; it takes a new number. Then it raises
+ *  latest to n + 1 if no newer frame has got there first. The compositor
+ *  copies the slot latest names and keeps the copy only if the sequence
+ *  word was 2n + 2 both before and after, so a frame being rewritten by a
+ *  producer that has lapped the ring is never shown half done. Any number
+ *  of producers can share the ring; a slot left odd by a producer that
+ *  died is skipped until the compositor recreates the ring.
+ */
+#ifndef FRAME_RING_H
+#define FRAME_RING_H
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "pixel_ops.h"
+#include "frame.h"
+
+#define RING_FILE "/dev/shm/rpic-frames"
+#define RING_MAGIC "RPIR"
+#define RING_VERSION 1
+#define RING_SLOTS 8
+#define RING_RETRIES 4 //reads of latest before the compositor gives up on a tick
+
+struct ring_header_t
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t slots;
+    uint32_t slot_bytes;     //FRAME_BYTES
+    _Atomic uint64_t head;   //next frame number to hand out
+    _Atomic uint64_t latest; //newest published frame number plus one, 0 before the first
+    _Atomic uint64_t seq[RING_SLOTS];
+};
+
+//the shared file, the slots start on a cache line of their own
+struct ring_shared_t
+{
+    struct ring_header_t h;
+    uint16_t slot[RING_SLOTS][PX_COUNT] __attribute__((aligned(64)));
+};
+
+struct frame_ring_t
+{
+    int fd;
+    struct ring_shared_t *sh;
+    uint64_t shown;       //latest as of the last frame the compositor took
+    unsigned long busy;   //slots a producer had to pass over
+    unsigned long torn;   //compositor copies thrown away
+};
+
+static inline int ring_map(struct frame_ring_t *r, const char *path, int flags)
+{
+    void *map;
+
+    memset(r, 0, sizeof(*r));
+    r->fd = open(path, flags | O_RDWR | O_CLOEXEC, 0666);
+    if (r->fd < 0)
+        return -1;
+    if (flags & O_CREAT && ftruncate(r->fd, sizeof(struct ring_shared_t)) < 0)
+        goto err;
+    map = mmap(NULL, sizeof(struct ring_shared_t), PROT_READ | PROT_WRITE, MAP_SHARED, r->fd, 0);
+    if (map == MAP_FAILED)
+        goto err;
+    r->sh = map;
+    return 0;
+
+err:
+    close(r->fd);
+    return -1;
+}
+
+//create the ring at path for the compositor, empty; producers still attached to an old
+//one keep it to themselves
+static inline int ring_create(struct frame_ring_t *r, const char *path)
+{
+    struct ring_header_t *h;
+
+    unlink(path);
+    if (ring_map(r, path, O_CREAT | O_EXCL) < 0)
+        return -1;
+    //fchmod, so the umask does not keep producers run by other users out
+    fchmod(r->fd, 0666);
+    h = &r->sh->h;
+    h->version = RING_VERSION;
+    h->slots = RING_SLOTS;
+    h->slot_bytes = FRAME_BYTES;
+    //magic last, a producer attaching meanwhile sees no ring rather than half of one
+    atomic_thread_fence(memory_order_release);
+    memcpy(h->magic, RING_MAGIC, 4);
+    return 0;
+}
+
+//attach a producer to the ring the compositor created at path
+static inline int ring_attach(struct frame_ring_t *r, const char *path)
+{
+    struct stat st;
+    const struct ring_header_t *h;
+
+    if (ring_map(r, path, 0) < 0)
+        return -1;
+    h = &r->sh->h;
+    if (fstat(r->fd, &st) < 0 || st.st_size < (off_t)sizeof(struct ring_shared_t) ||
+        memcmp(h->magic, RING_MAGIC, 4) != 0 || h->version != RING_VERSION || h->slots != RING_SLOTS ||
+        h->slot_bytes != FRAME_BYTES)
+    {
+        munmap(r->sh, sizeof(struct ring_shared_t));
+        close(r->fd);
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+static inline void ring_detach(struct frame_ring_t *r)
+{
+    munmap(r->sh, sizeof(struct ring_shared_t));
+    close(r->fd);
+}
+
+//claim a slot for the next frame, returns the slot to draw into and its frame number in *n
+static inline uint16_t *ring_begin(struct frame_ring_t *r, uint64_t *n)
+{
+    struct ring_header_t *h = &r->sh->h;
+    uint64_t s;
+    unsigned slot;
+
+    for (;;)
+    {
+        *n = atomic_fetch_add_explicit(&h->head, 1, memory_order_relaxed);
+        slot = *n % RING_SLOTS;
+        s = atomic_load_explicit(&h->seq[slot], memory_order_relaxed);
+        //odd, another producer is still writing it a whole ring ago; 2n + 1 or more, a
+        //producer that took a later ticket got there while this one stalled, and n is stale
+        if (!(s & 1) && s < 2 * *n + 1 &&
+            atomic_compare_exchange_strong_explicit(&h->seq[slot], &s, 2 * *n + 1, memory_order_relaxed,
+                                                    memory_order_relaxed))
+            break;
+        r->busy++;
+    }
+    //the odd sequence word is visible before any of the pixels
+    atomic_thread_fence(memory_order_release);
+    return r->sh->slot[slot];
+}
+
+//make frame n the one the compositor shows next, unless a newer one is already out
+static inline void ring_publish(struct frame_ring_t *r, uint64_t n)
+{
+    struct ring_header_t *h = &r->sh->h;
+    uint64_t latest = atomic_load_explicit(&h->latest, memory_order_relaxed);
+
+    atomic_store_explicit(&h->seq[n % RING_SLOTS], 2 * n + 2, memory_order_release);
+    while (latest < n + 1 && !atomic_compare_exchange_weak_explicit(&h->latest, &latest, n + 1,
+                                                                   memory_order_release, memory_order_relaxed))
+        ;
+}
+
+static inline void ring_submit(struct frame_ring_t *r, const uint16_t *pixel)
+{
+    uint64_t n;
+
+    px_copy(ring_begin(r, &n), pixel);
+    ring_publish(r, n);
+}
+
+//copy the newest complete frame into pixel; returns 1 for a frame not taken before, 0 when
+//there is none or no copy came out whole
+static inline int ring_take(struct frame_ring_t *r, uint16_t *pixel)
+{
+    struct ring_header_t *h = &r->sh->h;
+    uint64_t latest, n, s;
+    int tries;
+
+    for (tries = 0; tries < RING_RETRIES; tries++)
+    {
+        latest = atomic_load_explicit(&h->latest, memory_order_acquire);
+        if (latest == r->shown)
+            return 0;
+        n = latest - 1;
+        s = atomic_load_explicit(&h->seq[n % RING_SLOTS], memory_order_acquire);
+        if (s == 2 * n + 2)
+        {
+            px_copy(pixel, r->sh->slot[n % RING_SLOTS]);
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&h->seq[n % RING_SLOTS], memory_order_relaxed) == s)
+            {
+                r->shown = latest;
+                return 1;
+            }
+        }
+        //lapped or being rewritten, a newer frame is on its way
+        r->torn++;
+    }
+    return 0;
+}
+
+#endif
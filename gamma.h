@@ -0,0 +1,113 @@
+/*
+ *  Brightness and gamma stage for RGB565 frames, with temporal dithering.
+ *
+ *  Colours are treated as perceptual values and the LEDs as linear, so
+ *  each channel c out of max becomes max * (c / max * level / 256)^gamma.
+ *  A gamma of 1 is plain scaling, and level 256 with gamma 1 leaves every
+ *  pixel as it was. gamma_build() turns the settings into one table per
+ *  channel, holding the output level in 8.8 fixed point, and
+ *  gamma_apply() is then a single pass of table lookups over the 64
+ *  pixels.
+ *
+ *  The fraction a channel loses to the 5 and 6 bit output is either
+ *  rounded, or with dithering compared against a 4x4 ordered pattern that
+ *  shifts every frame. Over 16 frames each pixel sees all 16 thresholds,
+ *  so on average it shows the exact level, and dim colours fade smoothly
+ *  instead of in the few steps the low bits allow. Dithering only pays
+ *  off when the frame is presented every refresh, still or not.
+ *
+ *  gamma_build() needs libm, link with -lm.
+ */
+#ifndef GAMMA_H
+#define GAMMA_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "pixel_ops.h"
+
+#define GAMMA_LEVEL_MAX 256
+#define GAMMA_PHASES 16 //frames before the dither pattern repeats
+
+struct gamma_t
+{
+    unsigned level; //brightness, 0 - GAMMA_LEVEL_MAX
+    float gamma;
+    int dither;
+    uint16_t r[32], g[64], b[32];               //output level << 8
+    uint8_t threshold[GAMMA_PHASES][PX_COUNT];  //added before the shift, 128 everywhere to round
+};
+
+//4x4 Bayer matrix, every threshold once
+static const uint8_t gamma_bayer[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+
+static inline void gamma_channel(uint16_t *lut, int max, unsigned level, float gamma)
+{
+    float x;
+    int i;
+
+    for (i = 0; i <= max; i++)
+    {
+        x = (float)i * level / ((float)max * GAMMA_LEVEL_MAX);
+        lut[i] = (uint16_t)(max * 256.0f * (gamma == 1.0f ? x : powf(x, gamma)) + 0.5f);
+    }
+}
+
+//rebuild the tables after level, gamma or dither changed
+static inline void gamma_build(struct gamma_t *g)
+{
+    int p, i, x, y;
+
+    if (g->level > GAMMA_LEVEL_MAX)
+        g->level = GAMMA_LEVEL_MAX;
+    gamma_channel(g->r, 31, g->level, g->gamma);
+    gamma_channel(g->g, 63, g->level, g->gamma);
+    gamma_channel(g->b, 31, g->level, g->gamma);
+    for (p = 0; p < GAMMA_PHASES; p++)
+    {
+        for (i = 0; i < PX_COUNT; i++)
+        {
+            x = i % 8 + p;
+            y = i / 8 + p / 4;
+            g->threshold[p][i] = g->dither ? gamma_bayer[y & 3][x & 3] * 16 + 8 : 128;
+        }
+    }
+}
+
+static inline void gamma_init(struct gamma_t *g, unsigned level, float gamma, int dither)
+{
+    g->level = level;
+    g->gamma = gamma;
+    g->dither = dither;
+    gamma_build(g);
+}
+
+//level 256 and gamma 1, nothing to do
+static inline int gamma_identity(const struct gamma_t *g)
+{
+    return g->level == GAMMA_LEVEL_MAX && g->gamma == 1.0f;
+}
+
+//correct src into dst, which may be src; phase is the frame count and picks the pattern
+static inline void gamma_apply(const struct gamma_t *g, uint16_t *dst, const uint16_t *src, unsigned phase)
+{
+    const uint8_t *t = g->threshold[phase % GAMMA_PHASES];
+    uint16_t c;
+    int i;
+
+    //a table entry is at most max << 8, so adding a threshold under 256 cannot carry
+    for (i = 0; i < PX_COUNT; i++)
+    {
+        c = src[i];
+        dst[i] = (uint16_t)((g->r[PX_R(c)] + t[i]) >> 8 << 11 | (g->g[PX_G(c)] + t[i]) >> 8 << 5 |
+                            (g->b[PX_B(c)] + t[i]) >> 8);
+    }
+}
+
+#endif
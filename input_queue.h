@@ -0,0 +1,130 @@
+/*
+ *  Joystick input thread feeding a lock-free single-producer/single-consumer
+ *  ring of key codes.
+ *
+ *  The input thread is the only one that ever blocks on the evdev fd. It
+ *  decodes every key press in each batch it reads, pushes them in order
+ *  and pokes an eventfd so an epoll based loop wakes up. The game thread
+ *  pops the queued codes on its own schedule and never calls read() on
+ *  the joystick. Enter is not queued, it raises the quit flag instead.
+ */
+#ifndef INPUT_QUEUE_H
+#define INPUT_QUEUE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/eventfd.h>
+#include <linux/input.h>
+
+#define INPUT_QUEUE_SIZE 64 //power of two
+
+struct input_queue_t
+{
+    atomic_uint head; //next slot the producer fills
+    atomic_uint tail; //next slot the consumer takes
+    unsigned short codes[INPUT_QUEUE_SIZE];
+};
+
+struct input_thread_t
+{
+    pthread_t thread;
+    int evfd;   //joystick device, read only by the thread
+    int wakefd; //eventfd signalled after every batch, for the consumer's epoll
+    atomic_int quit;
+    struct input_queue_t queue;
+};
+
+//producer side, returns 0 and drops the code when the consumer is a full queue behind
+static inline int input_push(struct input_queue_t *q, unsigned short code)
+{
+    unsigned head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+
+    if (head - tail == INPUT_QUEUE_SIZE)
+        return 0;
+    q->codes[head % INPUT_QUEUE_SIZE] = code;
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return 1;
+}
+
+//consumer side, returns 0 when the queue is empty
+static inline int input_pop(struct input_queue_t *q, unsigned short *code)
+{
+    unsigned tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&q->head, memory_order_acquire);
+
+    if (head == tail)
+        return 0;
+    *code = q->codes[tail % INPUT_QUEUE_SIZE];
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+static inline void *input_thread_main(void *arg)
+{
+    struct input_thread_t *in = arg;
+    struct input_event ev[64];
+    uint64_t one = 1;
+    int i, rd;
+
+    for (;;)
+    {
+        rd = read(in->evfd, ev, sizeof(struct input_event) * 64);
+        if (rd < (int)sizeof(struct input_event))
+        {
+            fprintf(stderr, "expected %d bytes, got %d\n",
+                    (int)sizeof(struct input_event), rd);
+            return NULL;
+        }
+        for (i = 0; i < rd / (int)sizeof(struct input_event); i++)
+        {
+            if (ev[i].type != EV_KEY)
+                continue;
+            if (ev[i].value != 1)
+                continue;
+            if (ev[i].code == KEY_ENTER)
+                atomic_store(&in->quit, 1);
+            else
+                input_push(&in->queue, ev[i].code);
+        }
+        if (write(in->wakefd, &one, sizeof(one)) != sizeof(one))
+            return NULL;
+    }
+}
+
+static inline int input_thread_start(struct input_thread_t *in, int evfd)
+{
+    atomic_init(&in->queue.head, 0);
+    atomic_init(&in->queue.tail, 0);
+    atomic_init(&in->quit, 0);
+    in->evfd = evfd;
+    in->wakefd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (in->wakefd < 0)
+        return -1;
+    if (pthread_create(&in->thread, NULL, input_thread_main, in) != 0)
+    {
+        close(in->wakefd);
+        return -1;
+    }
+    return 0;
+}
+
+//clear the wakeup once the consumer has seen it
+static inline void input_thread_ack(struct input_thread_t *in)
+{
+    uint64_t n;
+    if (read(in->wakefd, &n, sizeof(n)) < 0)
+        return;
+}
+
+static inline void input_thread_stop(struct input_thread_t *in)
+{
+    pthread_cancel(in->thread);
+    pthread_join(in->thread, NULL);
+    close(in->wakefd);
+}
+
+#endif
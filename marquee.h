@@ -0,0 +1,131 @@
+/*
+ *  Streaming marquee for the 8x8 LED matrix.
+ *
+ *  The visible window is kept as one packed glyph, a byte per row, and the
+ *  glyph scrolling in behind it as another. A scroll step is a single
+ *  shift-and-or on the packed words that moves all eight rows one column
+ *  left and pulls in the next column, so a message of any length scrolls
+ *  in constant memory and each frame is one px_glyph() expansion.
+ *
+ *  With MARQUEE_PROPORTIONAL every glyph is trimmed to its inked columns
+ *  plus a one column gap (spaces get MARQUEE_SPACE), so text needs fewer
+ *  steps than with fixed 8 column cells.
+ */
+#ifndef MARQUEE_H
+#define MARQUEE_H
+
+#include <stdint.h>
+
+#include "ascii_letter.h"
+#include "pixel_ops.h"
+
+#define MARQUEE_FIXED 0
+#define MARQUEE_PROPORTIONAL 1
+#define MARQUEE_SPACE 3 //columns taken by a blank glyph in proportional mode
+
+//per row masks of the n leftmost and n rightmost columns, n 0 - 8
+#define MARQUEE_LEFT(n) (0x0101010101010101ULL * ((0xFF00u >> (n)) & 0xFF))
+#define MARQUEE_RIGHT(n) (0x0101010101010101ULL * (0xFFu >> (8 - (n))))
+
+struct marquee_t
+{
+    uint64_t win;     //what is on screen
+    uint64_t in;      //columns still to scroll in, leftmost next
+    int pending;      //how many columns in still holds, gap included
+    int room;         //blank columns right of the text, filled without scrolling
+    int proportional;
+};
+
+//move every row n columns left or right, 0 - 8, columns pushed out of a row are lost
+static inline uint64_t marquee_shl(uint64_t g, int n)
+{
+    return n >= 8 ? 0 : (g << n) & MARQUEE_LEFT(8 - n);
+}
+
+static inline uint64_t marquee_shr(uint64_t g, int n)
+{
+    return n >= 8 ? 0 : (g >> n) & MARQUEE_RIGHT(8 - n);
+}
+
+//shift glyph to the left edge, returns the columns it takes including the gap
+static inline int marquee_trim(uint64_t *glyph, int proportional)
+{
+    uint64_t cols = *glyph;
+    int lead, trail;
+
+    if (!proportional)
+        return 8;
+    //OR the rows together to get the inked columns
+    cols |= cols >> 32;
+    cols |= cols >> 16;
+    cols |= cols >> 8;
+    cols &= 0xFF;
+    if (cols == 0)
+        return MARQUEE_SPACE;
+    lead = __builtin_clz((unsigned)cols << 24);
+    trail = __builtin_ctz((unsigned)cols);
+    *glyph = marquee_shl(*glyph, lead);
+    return 8 - lead - trail + 1;
+}
+
+//start a new message with c on screen, at the left edge in proportional mode
+static inline void marquee_start(struct marquee_t *m, unsigned char c, int proportional)
+{
+    m->win = ascii_letter[c & 0x7F];
+    m->proportional = proportional;
+    m->room = 8 - marquee_trim(&m->win, proportional);
+    if (m->room < 0)
+        m->room = 0;
+    m->in = 0;
+    m->pending = 0;
+}
+
+//queue the glyph that follows, whatever of it fits beside the text on screen goes straight in
+static inline void marquee_feed(struct marquee_t *m, uint64_t glyph)
+{
+    int n;
+
+    m->pending = marquee_trim(&glyph, m->proportional);
+    m->in = glyph;
+    if (m->room == 0)
+        return;
+    n = m->pending < m->room ? m->pending : m->room;
+    m->win |= marquee_shr(m->in, 8 - m->room);
+    m->in = marquee_shl(m->in, n);
+    m->pending -= n;
+    m->room -= n;
+}
+
+//queue a full screen of blank, which scrolls the rest of the text off
+static inline void marquee_flush(struct marquee_t *m)
+{
+    int proportional = m->proportional;
+
+    m->proportional = MARQUEE_FIXED;
+    marquee_feed(m, 0);
+    m->proportional = proportional;
+}
+
+//blank columns still free on screen, nothing needs to scroll until they are used up
+static inline int marquee_room(const struct marquee_t *m)
+{
+    return m->room;
+}
+
+//scroll one column, returns 1 when the queued glyph is fully on screen and the next is due
+static inline int marquee_step(struct marquee_t *m)
+{
+    if (m->pending == 0)
+        return 1;
+    m->win = marquee_shl(m->win, 1) | marquee_shr(m->in, 7);
+    m->in = marquee_shl(m->in, 1);
+    return --m->pending == 0;
+}
+
+//write the visible 8x8 window into dst, unlit pixels take pal[0] and lit ones pal[1]
+static inline void marquee_frame(const struct marquee_t *m, uint16_t *dst, const uint16_t *pal)
+{
+    px_glyph(dst, m->win, pal[1], pal[0]);
+}
+
+#endif
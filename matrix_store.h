@@ -0,0 +1,247 @@
+/*
+ *  Binary save file for the user matrix, memory-mapped and crash-safe.
+ *
+ *  The file is one small fixed-size struct matrix_save_t in native byte
+ *  order: a magic and version header followed by two slots, each holding
+ *  the 64 pixels with a sequence number and a CRC-32. A save writes the
+ *  slot that is not current through the mapping, syncs it, and only then
+ *  is it current by virtue of its higher sequence number. A crash halfway
+ *  through leaves a slot that fails its CRC and the previous save is used.
+ *  Loading is a CRC check and one copy out of the mapped page.
+ *
+ *  A missing file is created, importing the old comma separated saved.txt
+ *  when there is one, by writing a temporary file, syncing it and renaming
+ *  it into place, so no crash ever leaves a half written save behind. A
+ *  file that is there but is not a save this version reads, say one from
+ *  a later format, is never replaced: opening it fails and it is left for
+ *  the user to move aside.
+ */
+#ifndef MATRIX_STORE_H
+#define MATRIX_STORE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "pixel_ops.h"
+
+#define MATRIX_SAVE "saved.bin"
+#define MATRIX_LEGACY "saved.txt"
+#define MATRIX_MAGIC "RPIM"
+#define MATRIX_VERSION 1
+
+//matrix_store_open() results, the negative ones leave nothing mapped
+#define MATRIX_OPENED 0    //an existing save
+#define MATRIX_CREATED 1   //a new empty save, there was nothing to import
+#define MATRIX_IMPORTED 2  //a new save holding the matrix of the legacy file
+#define MATRIX_ERROR -1    //see errno
+#define MATRIX_FOREIGN -2  //path holds something other than a save, left as it was
+
+struct matrix_slot_t
+{
+    uint32_t seq; //0 for a slot never written
+    uint32_t crc; //over seq and pixel
+    uint16_t pixel[PX_COUNT];
+};
+
+struct matrix_save_t
+{
+    char magic[4];
+    uint16_t version;
+    uint16_t payload; //bytes of pixels per slot, sizeof(pixel)
+    struct matrix_slot_t slot[2];
+};
+
+struct matrix_store_t
+{
+    int fd;
+    struct matrix_save_t *map;
+};
+
+//CRC-32 (IEEE, as zlib) a nibble at a time
+static inline uint32_t matrix_crc(uint32_t crc, const void *data, size_t len)
+{
+    static const uint32_t tab[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    const uint8_t *p = data;
+
+    crc = ~crc;
+    while (len--)
+    {
+        crc = (crc >> 4) ^ tab[(crc ^ *p) & 15];
+        crc = (crc >> 4) ^ tab[(crc ^ (*p++ >> 4)) & 15];
+    }
+    return ~crc;
+}
+
+static inline uint32_t matrix_slot_crc(const struct matrix_slot_t *s)
+{
+    return matrix_crc(matrix_crc(0, &s->seq, sizeof(s->seq)), s->pixel, sizeof(s->pixel));
+}
+
+//index of the valid slot with the highest sequence number, -1 if neither is valid
+static inline int matrix_current(const struct matrix_save_t *save)
+{
+    int i, best = -1;
+
+    for (i = 0; i < 2; i++)
+    {
+        const struct matrix_slot_t *s = &save->slot[i];
+        if (s->seq == 0 || s->crc != matrix_slot_crc(s))
+            continue;
+        if (best < 0 || s->seq > save->slot[best].seq)
+            best = i;
+    }
+    return best;
+}
+
+static inline int matrix_header_ok(const struct matrix_save_t *save)
+{
+    return memcmp(save->magic, MATRIX_MAGIC, 4) == 0 && save->version == MATRIX_VERSION &&
+           save->payload == sizeof(save->slot[0].pixel);
+}
+
+//read the old text save, 64 comma separated values, returns 0 if it held a full matrix
+static inline int matrix_import_legacy(const char *path, uint16_t *pixel)
+{
+    char line[500], *token;
+    FILE *f = fopen(path, "r");
+    int i = 0;
+
+    if (f == NULL)
+        return -1;
+    if (fgets(line, sizeof(line), f) != NULL)
+    {
+        for (token = strtok(line, ","); token != NULL && i < PX_COUNT; token = strtok(NULL, ","))
+            pixel[i++] = atoi(token);
+    }
+    fclose(f);
+    return i == PX_COUNT ? 0 : -1;
+}
+
+//write image to path through a synced temporary file and a rename, so path is always whole
+static inline int matrix_replace(const char *path, const struct matrix_save_t *image)
+{
+    char tmp[PATH_MAX], dir[PATH_MAX], *slash;
+    int fd, ok;
+
+    if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp))
+        return -1;
+    fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+        return -1;
+    ok = write(fd, image, sizeof(*image)) == sizeof(*image) && fsync(fd) == 0;
+    close(fd);
+    if (!ok || rename(tmp, path) < 0)
+    {
+        unlink(tmp);
+        return -1;
+    }
+
+    //the rename itself only survives a crash once the directory is synced
+    snprintf(dir, sizeof(dir), "%s", path);
+    slash = strrchr(dir, '/');
+    if (slash == NULL)
+        strcpy(dir, ".");
+    else if (slash == dir)
+        dir[1] = '\0';
+    else
+        *slash = '\0';
+    fd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0)
+    {
+        fsync(fd);
+        close(fd);
+    }
+    return 0;
+}
+
+//map the save at path, creating it (from legacy if that holds a matrix) when it is missing;
+//returns one of the MATRIX_ results above
+static inline int matrix_store_open(struct matrix_store_t *st, const char *path, const char *legacy)
+{
+    struct matrix_save_t image;
+    struct stat sb;
+    int result = MATRIX_OPENED;
+
+    st->fd = open(path, O_RDWR | O_CLOEXEC);
+    if (st->fd < 0 && errno != ENOENT)
+        return MATRIX_ERROR;
+    if (st->fd >= 0 && (fstat(st->fd, &sb) < 0 || sb.st_size != sizeof(image) ||
+                        pread(st->fd, &image, sizeof(image), 0) != sizeof(image) || !matrix_header_ok(&image)))
+    {
+        close(st->fd);
+        return MATRIX_FOREIGN;
+    }
+    if (st->fd < 0)
+    {
+        memset(&image, 0, sizeof(image));
+        memcpy(image.magic, MATRIX_MAGIC, 4);
+        image.version = MATRIX_VERSION;
+        image.payload = sizeof(image.slot[0].pixel);
+        result = MATRIX_CREATED;
+        if (legacy != NULL && matrix_import_legacy(legacy, image.slot[0].pixel) == 0)
+        {
+            image.slot[0].seq = 1;
+            image.slot[0].crc = matrix_slot_crc(&image.slot[0]);
+            result = MATRIX_IMPORTED;
+        }
+        if (matrix_replace(path, &image) < 0)
+            return MATRIX_ERROR;
+        st->fd = open(path, O_RDWR | O_CLOEXEC);
+        if (st->fd < 0)
+            return MATRIX_ERROR;
+    }
+
+    st->map = mmap(NULL, sizeof(*st->map), PROT_READ | PROT_WRITE, MAP_SHARED, st->fd, 0);
+    if (st->map == MAP_FAILED)
+    {
+        close(st->fd);
+        return MATRIX_ERROR;
+    }
+    return result;
+}
+
+//copy the latest good save into pixel, returns -1 and leaves pixel alone if there is none
+static inline int matrix_store_load(const struct matrix_store_t *st, uint16_t *pixel)
+{
+    int cur = matrix_current(st->map);
+
+    if (cur < 0)
+        return -1;
+    px_copy(pixel, st->map->slot[cur].pixel);
+    return 0;
+}
+
+//write pixel to the older slot and make it current, the other slot stays intact until then
+static inline int matrix_store_save(struct matrix_store_t *st, const uint16_t *pixel)
+{
+    int cur = matrix_current(st->map);
+    struct matrix_slot_t *s = &st->map->slot[cur == 0 ? 1 : 0];
+    uint32_t seq = cur < 0 ? 1 : st->map->slot[cur].seq + 1;
+
+    //an unchanged matrix is not worth a write
+    if (cur >= 0 && memcmp(st->map->slot[cur].pixel, pixel, sizeof(s->pixel)) == 0)
+        return 0;
+    px_copy(s->pixel, pixel);
+    s->seq = seq;
+    s->crc = matrix_slot_crc(s);
+    return msync(st->map, sizeof(*st->map), MS_SYNC);
+}
+
+static inline void matrix_store_close(struct matrix_store_t *st)
+{
+    munmap(st->map, sizeof(*st->map));
+    close(st->fd);
+}
+
+#endif
@@ -0,0 +1,439 @@
+/*
+ *  Datagram frame protocol for driving LED panels over the network.
+ *
+ *  One renderer sends each 8x8 tile of its canvas as a datagram over UDP
+ *  or a UNIX datagram socket, and a receiver on every Pi writes the tiles
+ *  it owns straight into their mapped framebuffers. A packet is a 12 byte
+ *  header, then the frame:
+ *
+ *    "RF" version kind  tile(16)  reserved(16)  seq(32)
+ *
+ *    NETFRAME_FULL   the 128 bytes of the frame as the framebuffer holds
+ *                    them, received straight into the mapping
+ *    NETFRAME_DELTA  one anim_codec.h frame coded against the tile's
+ *                    previous packet, decoded in place on the mapping
+ *
+ *  seq counts the packets of each tile. A receiver takes a full frame that
+ *  is newer than what it shows and a delta only when it follows the last
+ *  packet it took, so a lost or late packet costs no wrong pixels, just
+ *  the deltas up to the next full frame. The sender makes every
+ *  NETFRAME_KEY_INTERVAL-th packet of a tile a full one, and each flush
+ *  also resends one tile that did not change, so idle tiles heal too.
+ *
+ *  All the packets of one flush go out in a single sendmmsg(), so every
+ *  panel of a wall gets its part of a frame at the same time. Fields and
+ *  pixels are little endian, which both the Pi and a PC are.
+ */
+#ifndef NETFRAME_H
+#define NETFRAME_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "pixel_ops.h"
+#include "frame.h"
+#include "anim_codec.h"
+#include "canvas.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "netframe packets carry framebuffer pixels as they are and need a little endian host"
+#endif
+
+#define NETFRAME_MAGIC "RF"
+#define NETFRAME_VERSION 1
+#define NETFRAME_FULL 0
+#define NETFRAME_DELTA 1
+#define NETFRAME_KEY_INTERVAL 32 //packets of a tile between full frames
+#define NETFRAME_BATCH 64        //packets per sendmmsg()
+
+struct netframe_hdr_t
+{
+    char magic[2];
+    uint8_t version;
+    uint8_t kind;
+    uint16_t tile;
+    uint16_t reserved;
+    uint32_t seq;
+};
+
+#define NETFRAME_PACKET_MAX (sizeof(struct netframe_hdr_t) + ANIM_FRAME_MAX)
+
+struct netframe_addr_t
+{
+    struct sockaddr_storage sa;
+    socklen_t len;
+    int family;
+};
+
+//per tile sender state: the frame the receiver was last sent, which deltas code against
+struct netframe_tile_t
+{
+    uint32_t seq;
+    unsigned since_key;
+    int sent, queued;
+    uint16_t prev[PX_COUNT];
+};
+
+struct netframe_sender_t
+{
+    int fd;
+    struct netframe_addr_t to;
+    unsigned tiles, sweep, queued;
+    struct netframe_tile_t *tile;
+    struct mmsghdr msg[NETFRAME_BATCH];
+    struct iovec iov[NETFRAME_BATCH][2];
+    struct netframe_hdr_t hdr[NETFRAME_BATCH];
+    uint8_t payload[NETFRAME_BATCH][ANIM_FRAME_MAX];
+    unsigned long packets, keys, bytes, errors;
+};
+
+//per tile receiver state, fb is the mapped framebuffer the tile is written to
+struct netframe_rx_tile_t
+{
+    uint16_t *fb;
+    uint32_t seq;
+    int valid;
+};
+
+struct netframe_receiver_t
+{
+    int fd;
+    unsigned first, tiles; //tile ids first up to first + tiles - 1 are ours
+    struct netframe_rx_tile_t *tile;
+    unsigned long fulls, deltas, stale, gaps, foreign, bad;
+};
+
+//parse udp:host:port or unix:path; returns -1 with a message for anything else
+static inline int netframe_addr(struct netframe_addr_t *a, const char *spec, int passive)
+{
+    struct addrinfo hints, *res;
+    struct sockaddr_un *un = (struct sockaddr_un *)&a->sa;
+    char host[256];
+    const char *port;
+    int err;
+
+    memset(a, 0, sizeof(*a));
+    if (strncmp(spec, "unix:", 5) == 0)
+    {
+        if (strlen(spec + 5) >= sizeof(un->sun_path))
+        {
+            fprintf(stderr, "%s: socket path too long\n", spec);
+            return -1;
+        }
+        un->sun_family = AF_UNIX;
+        strcpy(un->sun_path, spec + 5);
+        a->len = sizeof(*un);
+        a->family = AF_UNIX;
+        return 0;
+    }
+    port = strrchr(spec, ':');
+    if (strncmp(spec, "udp:", 4) != 0 || port == NULL || port < spec + 4 ||
+        (size_t)(port - spec - 4) >= sizeof(host))
+    {
+        fprintf(stderr, "%s: expected udp:host:port or unix:path\n", spec);
+        return -1;
+    }
+    memcpy(host, spec + 4, port - spec - 4);
+    host[port - spec - 4] = '\0';
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+    err = getaddrinfo(host[0] ? host : NULL, port + 1, &hints, &res);
+    if (err != 0)
+    {
+        fprintf(stderr, "%s: %s\n", spec, gai_strerror(err));
+        return -1;
+    }
+    memcpy(&a->sa, res->ai_addr, res->ai_addrlen);
+    a->len = res->ai_addrlen;
+    a->family = res->ai_family;
+    freeaddrinfo(res);
+    return 0;
+}
+
+//send to the receiver at spec the frames of tile ids 0 up to tiles - 1
+static inline int netframe_sender_open(struct netframe_sender_t *s, const char *spec, unsigned tiles)
+{
+    memset(s, 0, sizeof(*s));
+    if (netframe_addr(&s->to, spec, 0) < 0)
+        return -1;
+    s->tile = calloc(tiles, sizeof(*s->tile));
+    if (s->tile == NULL)
+        return -1;
+    s->tiles = tiles;
+    s->fd = socket(s->to.family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (s->fd < 0)
+    {
+        free(s->tile);
+        return -1;
+    }
+    return 0;
+}
+
+static inline void netframe_sender_close(struct netframe_sender_t *s)
+{
+    close(s->fd);
+    free(s->tile);
+}
+
+//make the next packet of every tile a full frame, e.g. before a last frame that must arrive
+static inline void netframe_rekey(struct netframe_sender_t *s)
+{
+    unsigned i;
+
+    for (i = 0; i < s->tiles; i++)
+        s->tile[i].since_key = NETFRAME_KEY_INTERVAL;
+}
+
+//send the queued packets, a datagram the socket refuses is dropped like one lost on the way
+static inline void netframe_flush(struct netframe_sender_t *s)
+{
+    unsigned done = 0;
+    int n;
+
+    while (done < s->queued)
+    {
+        n = sendmmsg(s->fd, s->msg + done, s->queued - done, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+        {
+            //nobody listening on a UNIX path, or an ICMP error from an earlier datagram
+            s->errors++;
+            n = 1;
+        }
+        done += n;
+    }
+    for (done = 0; done < s->queued; done++)
+        s->tile[s->hdr[done].tile].queued = 0;
+    s->queued = 0;
+}
+
+//queue tile id tile showing pixel, coded against the last frame sent for it
+static inline void netframe_queue(struct netframe_sender_t *s, unsigned tile, const uint16_t *pixel)
+{
+    struct netframe_tile_t *t;
+    struct netframe_hdr_t *h;
+    struct iovec *iov;
+    int len = 0;
+
+    if (tile >= s->tiles)
+        return;
+    t = &s->tile[tile];
+    //a full frame is sent from prev, so a tile already waiting goes out before prev changes
+    if (s->queued == NETFRAME_BATCH || t->queued)
+        netframe_flush(s);
+    h = &s->hdr[s->queued];
+    iov = s->iov[s->queued];
+    if (t->sent && t->since_key < NETFRAME_KEY_INTERVAL)
+        len = anim_encode(s->payload[s->queued], t->prev, pixel, 0);
+    px_copy(t->prev, pixel);
+    memcpy(h->magic, NETFRAME_MAGIC, 2);
+    h->version = NETFRAME_VERSION;
+    h->tile = tile;
+    h->reserved = 0;
+    h->seq = ++t->seq;
+    iov[0].iov_base = h;
+    iov[0].iov_len = sizeof(*h);
+    if (len == 0 || len >= (int)FRAME_BYTES)
+    {
+        h->kind = NETFRAME_FULL;
+        iov[1].iov_base = t->prev;
+        iov[1].iov_len = FRAME_BYTES;
+        t->since_key = 0;
+        s->keys++;
+    }
+    else
+    {
+        h->kind = NETFRAME_DELTA;
+        iov[1].iov_base = s->payload[s->queued];
+        iov[1].iov_len = len;
+        t->since_key++;
+    }
+    memset(&s->msg[s->queued], 0, sizeof(s->msg[0]));
+    s->msg[s->queued].msg_hdr.msg_name = &s->to.sa;
+    s->msg[s->queued].msg_hdr.msg_namelen = s->to.len;
+    s->msg[s->queued].msg_hdr.msg_iov = iov;
+    s->msg[s->queued].msg_hdr.msg_iovlen = 2;
+    t->sent = 1;
+    t->queued = 1;
+    s->queued++;
+    s->packets++;
+    s->bytes += sizeof(*h) + iov[1].iov_len;
+}
+
+//resend the next tile in turn that is not queued already as a full frame of what it shows
+static inline void netframe_sweep(struct netframe_sender_t *s)
+{
+    unsigned i, t;
+
+    for (i = 0; i < s->tiles; i++)
+    {
+        t = s->sweep;
+        s->sweep = (s->sweep + 1) % s->tiles;
+        if (s->tile[t].sent && !s->tile[t].queued)
+        {
+            s->tile[t].since_key = NETFRAME_KEY_INTERVAL;
+            netframe_queue(s, t, s->tile[t].prev);
+            return;
+        }
+    }
+}
+
+//canvas_t remote hook: send the tiles a flush just presented, and one unchanged tile
+static inline void netframe_canvas_send(void *ctx, struct canvas_t *c, const uint32_t *tiles, uint32_t n)
+{
+    struct netframe_sender_t *s = ctx;
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+        netframe_queue(s, tiles[i], frame_pixels(&c->tile[tiles[i]]));
+    netframe_sweep(s);
+    netframe_flush(s);
+}
+
+//listen on spec for tile ids first up to first + tiles - 1, written to fb[0] onwards
+static inline int netframe_receiver_open(struct netframe_receiver_t *r, const char *spec, unsigned first,
+                                         unsigned tiles, uint16_t *const *fb)
+{
+    struct netframe_addr_t a;
+    unsigned i;
+
+    memset(r, 0, sizeof(*r));
+    if (netframe_addr(&a, spec, 1) < 0)
+        return -1;
+    r->tile = calloc(tiles, sizeof(*r->tile));
+    if (r->tile == NULL)
+        return -1;
+    for (i = 0; i < tiles; i++)
+        r->tile[i].fb = fb[i];
+    r->first = first;
+    r->tiles = tiles;
+    r->fd = socket(a.family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (r->fd < 0)
+        goto err;
+    //a socket file left behind by an earlier receiver would make the bind fail
+    if (a.family == AF_UNIX)
+        unlink(((struct sockaddr_un *)&a.sa)->sun_path);
+    if (bind(r->fd, (struct sockaddr *)&a.sa, a.len) < 0)
+    {
+        close(r->fd);
+        goto err;
+    }
+    return 0;
+
+err:
+    free(r->tile);
+    return -1;
+}
+
+static inline void netframe_receiver_close(struct netframe_receiver_t *r)
+{
+    close(r->fd);
+    free(r->tile);
+}
+
+//throw away the datagram at the head of the queue
+static inline void netframe_discard(struct netframe_receiver_t *r)
+{
+    char byte;
+
+    recv(r->fd, &byte, 1, MSG_TRUNC);
+}
+
+//wait for one datagram and apply it; returns 1 when a tile changed, 0 for a packet that
+//was dropped, -1 on a socket error (EINTR included, so a signal can end the loop)
+static inline int netframe_receive(struct netframe_receiver_t *r)
+{
+    struct netframe_hdr_t h;
+    struct netframe_rx_tile_t *t;
+    uint8_t buf[NETFRAME_PACKET_MAX];
+    struct iovec iov[2];
+    struct msghdr msg;
+    ssize_t n;
+
+    //look at the header first, so a full frame can then land right in the framebuffer
+    n = recv(r->fd, &h, sizeof(h), MSG_PEEK);
+    if (n < 0)
+        return -1;
+    if (n < (ssize_t)sizeof(h) || memcmp(h.magic, NETFRAME_MAGIC, 2) != 0 || h.version != NETFRAME_VERSION)
+    {
+        r->bad++;
+        netframe_discard(r);
+        return 0;
+    }
+    if (h.tile < r->first || h.tile - r->first >= r->tiles)
+    {
+        r->foreign++;
+        netframe_discard(r);
+        return 0;
+    }
+    t = &r->tile[h.tile - r->first];
+
+    if (h.kind == NETFRAME_FULL)
+    {
+        if (t->valid && (int32_t)(h.seq - t->seq) <= 0)
+        {
+            r->stale++;
+            netframe_discard(r);
+            return 0;
+        }
+        iov[0].iov_base = &h;
+        iov[0].iov_len = sizeof(h);
+        iov[1].iov_base = t->fb;
+        iov[1].iov_len = FRAME_BYTES;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = 2;
+        n = recvmsg(r->fd, &msg, 0);
+        if (n < 0)
+            return -1;
+        if (n != (ssize_t)(sizeof(h) + FRAME_BYTES) || msg.msg_flags & MSG_TRUNC)
+        {
+            //part of the frame may be on the panel, take only deltas after the next full one
+            t->valid = 0;
+            r->bad++;
+            return 0;
+        }
+        t->seq = h.seq;
+        t->valid = 1;
+        r->fulls++;
+        return 1;
+    }
+
+    n = recv(r->fd, buf, sizeof(buf), MSG_TRUNC);
+    if (n < 0)
+        return -1;
+    if (h.kind != NETFRAME_DELTA || n > (ssize_t)sizeof(buf))
+    {
+        r->bad++;
+        return 0;
+    }
+    if (!t->valid || h.seq != t->seq + 1)
+    {
+        if (t->valid && (int32_t)(h.seq - t->seq) <= 0)
+            r->stale++;
+        else
+            r->gaps++;
+        return 0;
+    }
+    //anim_decode() checks a frame is whole before it writes a pixel
+    if (anim_decode(buf + sizeof(h), n - sizeof(h), t->fb, NULL) <= 0)
+    {
+        r->bad++;
+        return 0;
+    }
+    t->seq = h.seq;
+    r->deltas++;
+    return 1;
+}
+
+#endif
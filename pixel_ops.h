@@ -0,0 +1,236 @@
+/*
+ *  Pixel operations on whole 8x8 RGB565 surfaces, uint16_t[64] in
+ *  row-major order like struct fb_t and the glyph atlas.
+ *
+ *  One row of eight pixels is exactly one 128-bit register, so every
+ *  operation here is a loop over eight rows of a few vector instructions.
+ *  The row primitives come in three flavours picked at compile time:
+ *  SSE2 on x86, NEON on ARM, and a plain C fallback elsewhere or when
+ *  PX_SCALAR is defined. All three give identical results.
+ *
+ *  Glyphs use the atlas bit order (pixel i is bit 63 - i), cell masks the
+ *  snake engine's (pixel i is bit i).
+ */
+#ifndef PIXEL_OPS_H
+#define PIXEL_OPS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PX_ROWS 8
+#define PX_COUNT 64
+
+#if defined(__SSE2__) && !defined(PX_SCALAR)
+#include <emmintrin.h>
+#define PX_SSE2 1
+typedef __m128i px_row_t;
+#elif defined(__ARM_NEON) && !defined(PX_SCALAR)
+#include <arm_neon.h>
+#define PX_NEON 1
+typedef uint16x8_t px_row_t;
+#else
+typedef struct
+{
+    uint16_t p[8];
+} px_row_t;
+#endif
+
+//RGB565 channels
+#define PX_R(c) ((c) >> 11)
+#define PX_G(c) (((c) >> 5) & 0x3F)
+#define PX_B(c) ((c) & 0x1F)
+#define PX_RGB(r, g, b) ((uint16_t)((r) << 11 | (g) << 5 | (b)))
+
+//bit of each pixel within a row byte, leftmost pixel first
+static const uint16_t px_bits_msb[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+static const uint16_t px_bits_lsb[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+
+#if PX_SSE2
+
+static inline px_row_t px_load(const uint16_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+static inline void px_store(uint16_t *p, px_row_t v) { _mm_storeu_si128((__m128i *)p, v); }
+static inline px_row_t px_splat(uint16_t c) { return _mm_set1_epi16((short)c); }
+static inline px_row_t px_and(px_row_t a, px_row_t b) { return _mm_and_si128(a, b); }
+static inline px_row_t px_or(px_row_t a, px_row_t b) { return _mm_or_si128(a, b); }
+static inline px_row_t px_add(px_row_t a, px_row_t b) { return _mm_add_epi16(a, b); }
+static inline px_row_t px_mul(px_row_t a, px_row_t b) { return _mm_mullo_epi16(a, b); }
+//a where mask is set, b elsewhere
+static inline px_row_t px_select(px_row_t mask, px_row_t a, px_row_t b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+//all ones in the lanes whose bit of row is set
+static inline px_row_t px_row_mask(unsigned row, const uint16_t *bits)
+{
+    px_row_t b = px_load(bits);
+    return _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16((short)row), b), b);
+}
+#define px_shr(v, n) _mm_srli_epi16(v, n)
+#define px_shl(v, n) _mm_slli_epi16(v, n)
+
+#elif PX_NEON
+
+static inline px_row_t px_load(const uint16_t *p) { return vld1q_u16(p); }
+static inline void px_store(uint16_t *p, px_row_t v) { vst1q_u16(p, v); }
+static inline px_row_t px_splat(uint16_t c) { return vdupq_n_u16(c); }
+static inline px_row_t px_and(px_row_t a, px_row_t b) { return vandq_u16(a, b); }
+static inline px_row_t px_or(px_row_t a, px_row_t b) { return vorrq_u16(a, b); }
+static inline px_row_t px_add(px_row_t a, px_row_t b) { return vaddq_u16(a, b); }
+static inline px_row_t px_mul(px_row_t a, px_row_t b) { return vmulq_u16(a, b); }
+static inline px_row_t px_select(px_row_t mask, px_row_t a, px_row_t b) { return vbslq_u16(mask, a, b); }
+static inline px_row_t px_row_mask(unsigned row, const uint16_t *bits)
+{
+    return vtstq_u16(vdupq_n_u16(row), vld1q_u16(bits));
+}
+#define px_shr(v, n) vshrq_n_u16(v, n)
+#define px_shl(v, n) vshlq_n_u16(v, n)
+
+#else
+
+static inline px_row_t px_load(const uint16_t *p)
+{
+    px_row_t v;
+    memcpy(v.p, p, sizeof(v.p));
+    return v;
+}
+static inline void px_store(uint16_t *p, px_row_t v) { memcpy(p, v.p, sizeof(v.p)); }
+static inline px_row_t px_splat(uint16_t c)
+{
+    px_row_t v;
+    for (int i = 0; i < 8; i++)
+        v.p[i] = c;
+    return v;
+}
+#define PX_LANEWISE(name, expr)                         \
+    static inline px_row_t name(px_row_t a, px_row_t b) \
+    {                                                   \
+        for (int i = 0; i < 8; i++)                     \
+            a.p[i] = (uint16_t)(expr);                  \
+        return a;                                       \
+    }
+PX_LANEWISE(px_and, a.p[i] & b.p[i])
+PX_LANEWISE(px_or, a.p[i] | b.p[i])
+PX_LANEWISE(px_add, a.p[i] + b.p[i])
+PX_LANEWISE(px_mul, a.p[i] * b.p[i])
+#undef PX_LANEWISE
+static inline px_row_t px_select(px_row_t mask, px_row_t a, px_row_t b)
+{
+    for (int i = 0; i < 8; i++)
+        a.p[i] = (a.p[i] & mask.p[i]) | (b.p[i] & ~mask.p[i]);
+    return a;
+}
+static inline px_row_t px_row_mask(unsigned row, const uint16_t *bits)
+{
+    px_row_t v;
+    for (int i = 0; i < 8; i++)
+        v.p[i] = row & bits[i] ? 0xFFFF : 0;
+    return v;
+}
+static inline px_row_t px_shr(px_row_t v, int n)
+{
+    for (int i = 0; i < 8; i++)
+        v.p[i] >>= n;
+    return v;
+}
+static inline px_row_t px_shl(px_row_t v, int n)
+{
+    for (int i = 0; i < 8; i++)
+        v.p[i] = (uint16_t)(v.p[i] << n);
+    return v;
+}
+
+#endif
+
+static inline void px_copy(uint16_t *dst, const uint16_t *src)
+{
+    for (int r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, px_load(src + 8 * r));
+}
+
+static inline void px_fill(uint16_t *dst, uint16_t color)
+{
+    px_row_t c = px_splat(color);
+    for (int r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, c);
+}
+
+//lit pixels of glyph take fg, the others bg
+static inline void px_glyph(uint16_t *dst, uint64_t glyph, uint16_t fg, uint16_t bg)
+{
+    px_row_t f = px_splat(fg), b = px_splat(bg);
+    for (int r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, px_select(px_row_mask((glyph >> (56 - 8 * r)) & 0xFF, px_bits_msb), f, b));
+}
+
+//lit pixels of glyph take color, the others are left as they are
+static inline void px_glyph_over(uint16_t *dst, uint64_t glyph, uint16_t color)
+{
+    px_row_t c = px_splat(color);
+    for (int r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, px_select(px_row_mask((glyph >> (56 - 8 * r)) & 0xFF, px_bits_msb), c,
+                                        px_load(dst + 8 * r)));
+}
+
+//px_glyph_over() for a mask in cell order, bit i is pixel i
+static inline void px_cells_over(uint16_t *dst, uint64_t cells, uint16_t color)
+{
+    px_row_t c = px_splat(color);
+    for (int r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, px_select(px_row_mask((cells >> (8 * r)) & 0xFF, px_bits_lsb), c,
+                                        px_load(dst + 8 * r)));
+}
+
+//a * wa + b * wb per channel, weights out of 256 summing to at most 256
+static inline px_row_t px_mix_row(px_row_t a, px_row_t b, px_row_t wa, px_row_t wb)
+{
+    px_row_t m5 = px_splat(0x1F), m6 = px_splat(0x3F);
+    px_row_t r, g, bl;
+
+    //each channel times a weight stays under 64 * 256, inside 16 bits
+    r = px_add(px_mul(px_shr(a, 11), wa), px_mul(px_shr(b, 11), wb));
+    g = px_add(px_mul(px_and(px_shr(a, 5), m6), wa), px_mul(px_and(px_shr(b, 5), m6), wb));
+    bl = px_add(px_mul(px_and(a, m5), wa), px_mul(px_and(b, m5), wb));
+    return px_or(px_or(px_shl(px_shr(r, 8), 11), px_shl(px_shr(g, 8), 5)), px_shr(bl, 8));
+}
+
+//brightness, every channel of src scaled by level / 256, level 0 - 256
+static inline void px_scale(uint16_t *dst, const uint16_t *src, unsigned level)
+{
+    px_row_t w = px_splat(level > 256 ? 256 : level), zero = px_splat(0);
+    for (int r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, px_mix_row(px_load(src + 8 * r), zero, w, zero));
+}
+
+//cross fade, t / 256 of the way from a to b, t 0 - 256
+static inline void px_fade(uint16_t *dst, const uint16_t *a, const uint16_t *b, unsigned t)
+{
+    px_row_t wb = px_splat(t > 256 ? 256 : t), wa = px_splat(t > 256 ? 0 : 256 - t);
+    for (int r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, px_mix_row(px_load(a + 8 * r), px_load(b + 8 * r), wa, wb));
+}
+
+//move every row n columns left (n < 0 right), uncovered pixels take fill, dst may be src
+static inline void px_shift_cols(uint16_t *dst, const uint16_t *src, int n, uint16_t fill)
+{
+    //each row is staged followed by a run of fill, so the run before it is the previous
+    //row's; the result rows are unaligned windows of that, loaded only once every store
+    //is done so no load waits on a store it straddles
+    uint16_t line[(PX_ROWS + 1) * 16];
+    px_row_t f = px_splat(fill);
+    int r;
+
+    if (n > 8)
+        n = 8;
+    if (n < -8)
+        n = -8;
+    px_store(line + 8, f);
+    for (r = 0; r < PX_ROWS; r++)
+    {
+        px_store(line + 16 * (r + 1), px_load(src + 8 * r));
+        px_store(line + 16 * (r + 1) + 8, f);
+    }
+    for (r = 0; r < PX_ROWS; r++)
+        px_store(dst + 8 * r, px_load(line + 16 * (r + 1) + n));
+}
+
+#endif
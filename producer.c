@@ -0,0 +1,107 @@
+/*
+ *  Example frame ring producer: a CPU load graph drawn by a process of its
+ *  own and shown by assignmentQ3 after its ring command.
+ *
+ *    producer [-f fps] [-n frames]
+ *
+ *  Every frame samples /proc/stat, scrolls the graph one column left and
+ *  draws the load since the last frame as a bar on the right, green when
+ *  low and red when high. The frame goes into the ring with ring_submit(),
+ *  a copy into shared memory and no system call.
+ *
+ *  Build with:  gcc -Wall -O2 producer.c -o producer
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "pixel_ops.h"
+#include "frame_ring.h"
+#include "anim_clock.h"
+
+//busy and total jiffies over all CPUs
+static int cpuTimes(unsigned long long *busy, unsigned long long *total)
+{
+    unsigned long long v[8] = {0};
+    FILE *f = fopen("/proc/stat", "r");
+    int i, n;
+
+    if (f == NULL)
+        return -1;
+    n = fscanf(f, "cpu %llu %llu %llu %llu %llu %llu %llu %llu", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5],
+               &v[6], &v[7]);
+    fclose(f);
+    if (n < 4)
+        return -1;
+    for (i = 0, *total = 0; i < 8; i++)
+        *total += v[i];
+    *busy = *total - v[3] - v[4]; //idle and iowait
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    static const uint16_t level[8] = {0x07E0, 0x07E0, 0x07E0, 0x5FE0, 0xAFE0, 0xFFE0, 0xFC00, 0xF800};
+    struct frame_ring_t ring;
+    struct anim_clock_t clock;
+    unsigned long long busy, total, last_busy = 0, last_total = 0;
+    unsigned long frames = 0, count = 0;
+    unsigned fps = 10;
+    uint16_t graph[PX_COUNT];
+    int opt, y, bar;
+
+    while ((opt = getopt(argc, argv, "f:n:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'f':
+            fps = strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            count = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-f fps] [-n frames]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (fps == 0)
+        return EXIT_FAILURE;
+    if (ring_attach(&ring, RING_FILE) < 0)
+    {
+        perror("Error attaching to " RING_FILE ", is assignmentQ3 showing the ring");
+        return EXIT_FAILURE;
+    }
+
+    px_fill(graph, 0);
+    anim_start(&clock, fps);
+    while (count == 0 || frames < count)
+    {
+        if (cpuTimes(&busy, &total) < 0)
+        {
+            perror("Error reading /proc/stat");
+            break;
+        }
+        bar = total > last_total ? (int)((busy - last_busy) * 8 / (total - last_total)) : 0;
+        last_busy = busy;
+        last_total = total;
+
+        //row y holds the graph at height 8 - y, column 7 is the newest sample
+        for (y = 0; y < 8; y++)
+        {
+            memmove(graph + 8 * y, graph + 8 * y + 1, 7 * sizeof(*graph));
+            graph[8 * y + 7] = 7 - y < bar ? level[7 - y] : 0;
+        }
+        ring_submit(&ring, graph);
+        frames++;
+        anim_wait(&clock);
+    }
+    //leave the display blank rather than on a stale graph
+    px_fill(graph, 0);
+    ring_submit(&ring, graph);
+    ring_detach(&ring);
+    return 0;
+}
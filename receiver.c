@@ -0,0 +1,148 @@
+/*
+ *  Receiver daemon for netframe.h: shows the tiles a remote renderer sends
+ *  on this Pi's LED matrix, or on several emulated panels.
+ *
+ *    receiver [-t first_tile] [-n tiles] udp:host:port|unix:path
+ *
+ *  Tile ids first_tile up to first_tile + tiles - 1 are taken, anything
+ *  else is counted and dropped. A single tile goes to the Sense HAT
+ *  framebuffer, or SENSE_HAT_FB; with SENSE_HAT_WALL set, tile id i goes
+ *  to the panel the pattern names with i. Full frames are received
+ *  straight into the mapping and deltas decoded in place on it.
+ *
+ *  Runs until SIGINT or SIGTERM, then prints what it got.
+ *
+ *  Build with:  gcc -Wall -O2 receiver.c -o receiver -pthread
+ */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+
+#include <linux/input.h>
+#include <linux/fb.h>
+
+#include "sense_hat.h"
+#include "frame.h"
+#include "canvas.h"
+#include "netframe.h"
+
+static volatile sig_atomic_t stop;
+
+static void onSignal(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
+int main(int argc, char *argv[])
+{
+    struct netframe_receiver_t rx;
+    struct sigaction sa;
+    struct canvas_t panels;
+    uint16_t **fb;
+    void *map;
+    int opt, fd, i, first = 0, tiles = 1;
+
+    while ((opt = getopt(argc, argv, "t:n:")) != -1)
+    {
+        switch (opt)
+        {
+        case 't':
+            first = atoi(optarg);
+            break;
+        case 'n':
+            tiles = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-t first_tile] [-n tiles] udp:host:port|unix:path\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind != argc - 1 || first < 0 || tiles < 1 || first + tiles > UINT16_MAX + 1)
+    {
+        fprintf(stderr, "usage: %s [-t first_tile] [-n tiles] udp:host:port|unix:path\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    //the panels are mapped the way the renderer maps its own, this also clears them
+    if (canvas_init(&panels, tiles, 1) < 0)
+    {
+        perror("Error allocating the panels");
+        return EXIT_FAILURE;
+    }
+    if (getenv(CANVAS_WALL_ENV) != NULL)
+    {
+        if (canvas_open_tiles(&panels, getenv(CANVAS_WALL_ENV), first) < 0)
+            goto err;
+    }
+    else if (tiles == 1)
+    {
+        fd = open_fbdev("RPi-Sense FB");
+        if (fd < 0)
+        {
+            fprintf(stderr, "Error: cannot open framebuffer device.\n");
+            goto err;
+        }
+        map = mmap(NULL, SENSE_FB_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED)
+        {
+            perror("Error mmapping the file");
+            close(fd);
+            goto err;
+        }
+        panels.fd[0] = fd;
+        canvas_attach(&panels, 0, map);
+    }
+    else
+    {
+        fprintf(stderr, "more than one tile needs " CANVAS_WALL_ENV " set to a pattern naming every panel\n");
+        goto err;
+    }
+
+    fb = malloc(tiles * sizeof(*fb));
+    if (fb == NULL)
+        goto err;
+    for (i = 0; i < tiles; i++)
+        fb[i] = &panels.tile[i].dev->pixel[0][0];
+    if (netframe_receiver_open(&rx, argv[optind], first, tiles, fb) < 0)
+    {
+        perror(argv[optind]);
+        free(fb);
+        goto err;
+    }
+    free(fb);
+
+    //no SA_RESTART, so a signal ends the wait in recv()
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = onSignal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    while (!stop)
+    {
+        if (netframe_receive(&rx) < 0 && errno != EINTR)
+        {
+            perror("Error receiving frames");
+            break;
+        }
+    }
+
+    fprintf(stderr, "%lu full, %lu delta, %lu stale, %lu after a gap, %lu other tiles, %lu bad\n",
+            rx.fulls, rx.deltas, rx.stale, rx.gaps, rx.foreign, rx.bad);
+    netframe_receiver_close(&rx);
+    canvas_free(&panels);
+    return 0;
+
+err:
+    canvas_free(&panels);
+    return EXIT_FAILURE;
+}
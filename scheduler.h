@@ -0,0 +1,152 @@
+/*
+ *  Tick scheduler for the game loops, built on timerfd and epoll.
+ *
+ *  The timer runs on absolute CLOCK_MONOTONIC deadlines, so the tick rate
+ *  does not drift by however long logic and rendering took. sched_wait()
+ *  sleeps until either the next deadline or input on the joystick fd,
+ *  whichever comes first, so key presses are handled as they arrive.
+ *  Deadlines that passed while the caller was busy are counted in missed.
+ *  More descriptors can be watched with sched_watch(), each reported as
+ *  its own event bit, and a period of 0 stops the timer.
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+#define SCHED_TICK 1
+#define SCHED_INPUT 2
+#define SCHED_USER 4 //first event bit free for sched_watch()
+#define SCHED_MAX_EVENTS 8
+
+struct sched_t
+{
+    int epfd;
+    int timerfd;
+    int inputfd;           //-1 when there is nothing to watch
+    long period_ns;
+    unsigned long ticks;   //deadlines reported to the caller
+    unsigned long missed;  //deadlines that expired unseen behind another one
+    unsigned long expired; //deadlines covered by the last SCHED_TICK, normally 1
+};
+
+//arm the timer so the first tick lands one period from now, 0 disarms it
+static inline int sched_set_period(struct sched_t *s, long period_ns)
+{
+    struct itimerspec its;
+    struct timespec now;
+
+    s->period_ns = period_ns;
+    if (period_ns == 0)
+    {
+        memset(&its, 0, sizeof(its));
+        return timerfd_settime(s->timerfd, 0, &its, NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    its.it_interval.tv_sec = period_ns / 1000000000L;
+    its.it_interval.tv_nsec = period_ns % 1000000000L;
+    its.it_value.tv_sec = now.tv_sec + its.it_interval.tv_sec;
+    its.it_value.tv_nsec = now.tv_nsec + its.it_interval.tv_nsec;
+    if (its.it_value.tv_nsec >= 1000000000L)
+    {
+        its.it_value.tv_sec++;
+        its.it_value.tv_nsec -= 1000000000L;
+    }
+    return timerfd_settime(s->timerfd, TFD_TIMER_ABSTIME, &its, NULL);
+}
+
+//report readiness of fd as event, the fd rides along in the upper half of the data
+static inline int sched_watch(struct sched_t *s, int fd, unsigned event)
+{
+    struct epoll_event ev;
+
+    ev.events = EPOLLIN;
+    ev.data.u64 = (uint64_t)fd << 32 | event;
+    return epoll_ctl(s->epfd, EPOLL_CTL_ADD, fd, &ev);
+}
+
+static inline int sched_unwatch(struct sched_t *s, int fd)
+{
+    return epoll_ctl(s->epfd, EPOLL_CTL_DEL, fd, NULL);
+}
+
+static inline int sched_init(struct sched_t *s, long period_ns, int inputfd)
+{
+    memset(s, 0, sizeof(*s));
+    s->inputfd = inputfd;
+    s->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (s->epfd < 0)
+        return -1;
+    s->timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (s->timerfd < 0)
+        goto err_ep;
+
+    if (sched_watch(s, s->timerfd, SCHED_TICK) < 0)
+        goto err_timer;
+    if (inputfd >= 0 && sched_watch(s, inputfd, SCHED_INPUT) < 0)
+        goto err_timer;
+    if (sched_set_period(s, period_ns) < 0)
+        goto err_timer;
+    return 0;
+
+err_timer:
+    close(s->timerfd);
+err_ep:
+    close(s->epfd);
+    return -1;
+}
+
+//block until the next deadline or input, returns SCHED_TICK, SCHED_INPUT and any watched
+//events that fired, -1 on error
+static inline int sched_wait(struct sched_t *s)
+{
+    struct epoll_event evs[SCHED_MAX_EVENTS];
+    uint64_t expired;
+    unsigned event;
+    int i, n, events = 0;
+
+    do
+    {
+        n = epoll_wait(s->epfd, evs, SCHED_MAX_EVENTS, -1);
+    } while (n < 0 && errno == EINTR);
+    if (n < 0)
+        return -1;
+
+    for (i = 0; i < n; i++)
+    {
+        event = (uint32_t)evs[i].data.u64;
+        if (event == SCHED_TICK)
+        {
+            if (read(s->timerfd, &expired, sizeof(expired)) == sizeof(expired) && expired > 0)
+            {
+                s->ticks++;
+                s->missed += expired - 1;
+                s->expired = expired;
+                events |= SCHED_TICK;
+            }
+        }
+        else
+        {
+            //a hangup is reported too, so a reader sees its EOF, but the fd is not
+            //watched any longer rather than spinning on it
+            if (!(evs[i].events & EPOLLIN))
+                sched_unwatch(s, (int)(evs[i].data.u64 >> 32));
+            events |= event;
+        }
+    }
+    return events;
+}
+
+static inline void sched_close(struct sched_t *s)
+{
+    close(s->timerfd);
+    close(s->epfd);
+}
+
+#endif
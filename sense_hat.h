@@ -0,0 +1,243 @@
+/*
+ *  Display and joystick backends for the Raspberry Pi Sense HAT.
+ *
+ *  open_fbdev() and open_evdev() look up the real LED framebuffer and
+ *  joystick by name. When SENSE_HAT_FB is set in the environment they hand
+ *  back emulated devices instead, so the programs run unchanged on any
+ *  Linux box:
+ *
+ *    SENSE_HAT_FB=/dev/shm/sensehat      file mmapped as the 8x8 RGB565 surface
+ *    SENSE_HAT_INPUT=moves.txt           joystick script fed as input_events
+ *
+ *  A joystick script has one command per line, '#' starts a comment:
+ *
+ *    up | down | left | right | enter    press and release that key
+ *    wait <ms>                           pause before the next command
+ *
+ *  Without SENSE_HAT_INPUT the emulated joystick stays idle.
+ */
+#ifndef SENSE_HAT_H
+#define SENSE_HAT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <sys/time.h>
+#include <sys/prctl.h>
+#include <linux/fb.h>
+#include <linux/input.h>
+
+#define DEV_INPUT_EVENT "/dev/input"
+#define EVENT_DEV_NAME "event"
+#define DEV_FB "/dev"
+#define FB_DEV_NAME "fb"
+
+#define SENSE_FB_ENV "SENSE_HAT_FB"
+#define SENSE_INPUT_ENV "SENSE_HAT_INPUT"
+
+#define SENSE_FB_SIZE 128 //8x8 pixels of RGB565
+
+static inline int is_event_device(const struct dirent *dir)
+{
+    return strncmp(EVENT_DEV_NAME, dir->d_name,
+                   strlen(EVENT_DEV_NAME) - 1) == 0;
+}
+static inline int is_framebuffer_device(const struct dirent *dir)
+{
+    return strncmp(FB_DEV_NAME, dir->d_name,
+                   strlen(FB_DEV_NAME) - 1) == 0;
+}
+
+//open (creating if needed) a file to be mmapped in place of the LED framebuffer
+static inline int emu_open_fb(const char *path)
+{
+    struct stat st;
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+        return fd;
+    if (fstat(fd, &st) < 0 || (st.st_size < SENSE_FB_SIZE && ftruncate(fd, SENSE_FB_SIZE) < 0))
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static inline void emu_write_event(int fd, unsigned short type, unsigned short code, int value)
+{
+    struct input_event ev;
+    memset(&ev, 0, sizeof(ev));
+    gettimeofday(&ev.time, NULL);
+    ev.type = type;
+    ev.code = code;
+    ev.value = value;
+    if (write(fd, &ev, sizeof(ev)) != sizeof(ev))
+        _exit(EXIT_FAILURE);
+}
+
+//play a joystick script into fd, one press/release pair per key line
+static inline void emu_play_script(FILE *script, int fd)
+{
+    static const struct
+    {
+        const char *name;
+        unsigned short code;
+    } keys[] = {
+        {"up", KEY_UP},
+        {"down", KEY_DOWN},
+        {"left", KEY_LEFT},
+        {"right", KEY_RIGHT},
+        {"enter", KEY_ENTER},
+    };
+    char line[128], word[16];
+    int ms, i;
+
+    while (fgets(line, sizeof(line), script) != NULL)
+    {
+        if (sscanf(line, "%15s", word) != 1 || word[0] == '#')
+            continue;
+        if (strcmp(word, "wait") == 0)
+        {
+            if (sscanf(line, "%*s %d", &ms) == 1 && ms > 0)
+                usleep(ms * 1000);
+            continue;
+        }
+        for (i = 0; i < (int)(sizeof(keys) / sizeof(keys[0])); i++)
+        {
+            if (strcmp(word, keys[i].name) == 0)
+            {
+                emu_write_event(fd, EV_KEY, keys[i].code, 1);
+                emu_write_event(fd, EV_SYN, SYN_REPORT, 0);
+                emu_write_event(fd, EV_KEY, keys[i].code, 0);
+                emu_write_event(fd, EV_SYN, SYN_REPORT, 0);
+                break;
+            }
+        }
+        if (i == (int)(sizeof(keys) / sizeof(keys[0])))
+            fprintf(stderr, "joystick script: unknown command '%s'\n", word);
+    }
+}
+
+//return the read end of a pipe carrying input_events, the same records evdev delivers
+//a child process plays the script (if any) into it and then holds it open until we exit
+static inline int emu_open_evdev(const char *script_path)
+{
+    int fds[2];
+    pid_t pid;
+    FILE *script = NULL;
+
+    if (script_path != NULL)
+    {
+        script = fopen(script_path, "r");
+        if (script == NULL)
+            return -1;
+    }
+    if (pipe(fds) < 0)
+    {
+        if (script)
+            fclose(script);
+        return -1;
+    }
+    pid = fork();
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        if (script)
+            fclose(script);
+        return -1;
+    }
+    if (pid == 0)
+    {
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+        close(fds[0]);
+        if (script)
+            emu_play_script(script, fds[1]);
+        for (;;)
+            pause();
+    }
+    close(fds[1]);
+    if (script)
+        fclose(script);
+    return fds[0];
+}
+
+static inline int open_evdev(const char *dev_name)
+{
+    struct dirent **namelist;
+    int i, ndev;
+    int fd = -1;
+
+    if (getenv(SENSE_INPUT_ENV) != NULL || getenv(SENSE_FB_ENV) != NULL)
+        return emu_open_evdev(getenv(SENSE_INPUT_ENV));
+
+    ndev = scandir(DEV_INPUT_EVENT, &namelist, is_event_device, versionsort);
+    if (ndev <= 0)
+        return -1;
+
+    for (i = 0; i < ndev; i++)
+    {
+        char fname[64];
+        char name[256];
+
+        snprintf(fname, sizeof(fname),
+                 "%s/%s", DEV_INPUT_EVENT, namelist[i]->d_name);
+        fd = open(fname, O_RDONLY);
+        if (fd < 0)
+            continue;
+        ioctl(fd, EVIOCGNAME(sizeof(name)), name);
+        if (strcmp(dev_name, name) == 0)
+            break;
+        close(fd);
+        fd = -1;
+    }
+
+    for (i = 0; i < ndev; i++)
+        free(namelist[i]);
+
+    return fd;
+}
+
+static inline int open_fbdev(const char *dev_name)
+{
+    struct dirent **namelist;
+    int i, ndev;
+    int fd = -1;
+    struct fb_fix_screeninfo fix_info;
+
+    if (getenv(SENSE_FB_ENV) != NULL)
+        return emu_open_fb(getenv(SENSE_FB_ENV));
+
+    ndev = scandir(DEV_FB, &namelist, is_framebuffer_device, versionsort);
+    if (ndev <= 0)
+        return -1;
+
+    for (i = 0; i < ndev; i++)
+    {
+        char fname[64];
+
+        snprintf(fname, sizeof(fname),
+                 "%s/%s", DEV_FB, namelist[i]->d_name);
+        fd = open(fname, O_RDWR);
+        if (fd < 0)
+            continue;
+        ioctl(fd, FBIOGET_FSCREENINFO, &fix_info);
+        if (strcmp(dev_name, fix_info.id) == 0)
+            break;
+        close(fd);
+        fd = -1;
+    }
+    for (i = 0; i < ndev; i++)
+        free(namelist[i]);
+
+    return fd;
+}
+
+#endif
@@ -1,8 +1,9 @@
+/*
+ *  Snake on the Sense HAT LED matrix, steered with the joystick.
+ *
+ *  Build with:  gcc -Wall -O2 snake.c -o snake -pthread
+ */
 #define _GNU_SOURCE
-#define DEV_INPUT_EVENT "/dev/input"
-#define EVENT_DEV_NAME "event"
-#define DEV_FB "/dev"
-#define FB_DEV_NAME "fb"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -19,294 +20,95 @@
 #include <linux/input.h>
 #include <linux/fb.h>
 
-enum direction_t
-{
-	UP,
-	RIGHT,
-	DOWN,
-	LEFT,
-	NONE,
-};
-struct segment_t
-{
-	struct segment_t *next;
-	int x;
-	int y;
-};
-struct snake_t
-{
-	struct segment_t head;
-	struct segment_t *tail;
-	enum direction_t heading;
-};
-struct apple_t
-{
-	int x;
-	int y;
-};
-
-struct fb_t
-{
-	uint16_t pixel[8][8];
-};
-
-int running = 1;
+#include "sense_hat.h"
+#include "frame.h"
+#include "snake_engine.h"
+#include "scheduler.h"
+#include "snake_ai.h"
+#include "snake_render.h"
 
-struct snake_t snake = {
-	{NULL, 4, 4},
-	NULL,
-	NONE,
-};
-struct apple_t apple = {
-	4,
-	4,
-};
+struct snake_speed_t speed = SNAKE_SPEED_DEFAULT;
 
-struct fb_t *fb;
-
-static int is_event_device(const struct dirent *dir)
-{
-	return strncmp(EVENT_DEV_NAME, dir->d_name,
-				   strlen(EVENT_DEV_NAME) - 1) == 0;
-}
-static int is_framebuffer_device(const struct dirent *dir)
+//run ticks simulation steps back to back with random turns, nothing is drawn and nothing sleeps
+void turbo(struct snake_game_t *g, unsigned long ticks)
 {
-	return strncmp(FB_DEV_NAME, dir->d_name,
-				   strlen(FB_DEV_NAME) - 1) == 0;
-}
-
-static int open_evdev(const char *dev_name)
-{
-	struct dirent **namelist;
-	int i, ndev;
-	int fd = -1;
-
-	ndev = scandir(DEV_INPUT_EVENT, &namelist, is_event_device, versionsort);
-	if (ndev <= 0)
-		return ndev;
+	static const unsigned int keys[] = {KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT};
+	struct timespec start, end;
+	unsigned long i, rounds = 0;
+	double secs;
 
-	for (i = 0; i < ndev; i++)
+	reset(g);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < ticks; i++)
 	{
-		char fname[64];
-		char name[256];
-
-		snprintf(fname, sizeof(fname),
-				 "%s/%s", DEV_INPUT_EVENT, namelist[i]->d_name);
-		fd = open(fname, O_RDONLY);
-		if (fd < 0)
-			continue;
-		ioctl(fd, EVIOCGNAME(sizeof(name)), name);
-		if (strcmp(dev_name, name) == 0)
-			break;
-		close(fd);
+		if (snake_rand(g) % 4 == 0)
+			change_dir(g, keys[snake_rand(g) % 4]);
+		rounds += snake_step(g);
 	}
-
-	for (i = 0; i < ndev; i++)
-		free(namelist[i]);
-
-	return fd;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+	printf("%lu ticks in %.3f s, %.0f ticks/s, %lu rounds\n",
+		   ticks, secs, ticks / secs, rounds);
 }
 
-static int open_fbdev(const char *dev_name)
-{
-	struct dirent **namelist;
-	int i, ndev;
-	int fd = -1;
-	struct fb_fix_screeninfo fix_info;
-
-	ndev = scandir(DEV_FB, &namelist, is_framebuffer_device, versionsort);
-	if (ndev <= 0)
-		return ndev;
-
-	for (i = 0; i < ndev; i++)
-	{
-		char fname[64];
-		char name[256];
-
-		snprintf(fname, sizeof(fname),
-				 "%s/%s", DEV_FB, namelist[i]->d_name);
-		fd = open(fname, O_RDWR);
-		if (fd < 0)
-			continue;
-		ioctl(fd, FBIOGET_FSCREENINFO, &fix_info);
-		if (strcmp(dev_name, fix_info.id) == 0)
-			break;
-		close(fd);
-		fd = -1;
-	}
-	for (i = 0; i < ndev; i++)
-		free(namelist[i]);
-
-	return fd;
-}
-
-void render()
-{
-	struct segment_t *seg_i;
-	memset(fb, 0, 128);
-	fb->pixel[apple.x][apple.y] = 0xF800;
-	for (seg_i = snake.tail; seg_i->next; seg_i = seg_i->next)
-	{
-		fb->pixel[seg_i->x][seg_i->y] = 0x7E0;
-	}
-	fb->pixel[seg_i->x][seg_i->y] = 0xFFFF;
-}
-
-int check_collision(int appleCheck)
+int main(int argc, char *args[])
 {
-	struct segment_t *seg_i;
-
-	if (appleCheck)
-	{
-		for (seg_i = snake.tail; seg_i; seg_i = seg_i->next)
-		{
-			if (seg_i->x == apple.x && seg_i->y == apple.y)
-				return 1;
-		}
-		return 0;
-	}
-
-	for (seg_i = snake.tail; seg_i->next; seg_i = seg_i->next)
-	{
-		if (snake.head.x == seg_i->x && snake.head.y == seg_i->y)
-			return 1;
-	}
-
-	if (snake.head.x < 0 || snake.head.x > 7 ||
-		snake.head.y < 0 || snake.head.y > 7)
-	{
-		return 1;
-	}
-	return 0;
-}
+	int ret = 0;
+	int running = 1;
+	int fbfd = 0;
+	int opt, events;
+	unsigned long steps, turbo_ticks = 0;
+	unsigned int seed = time(NULL);
+	int autoplay = 0;
+	void *map;
+	struct frame_t frame;
+	struct snake_game_t game;
+	struct sched_t sched;
+	struct input_thread_t input;
+	struct pollfd evpoll = {
+		.events = POLLIN,
+	};
 
-void game_logic(void)
-{
-	struct segment_t *seg_i;
-	struct segment_t *new_tail;
-	for (seg_i = snake.tail; seg_i->next; seg_i = seg_i->next)
+	while ((opt = getopt(argc, args, "t:s:m:r:T:a")) != -1)
 	{
-		seg_i->x = seg_i->next->x;
-		seg_i->y = seg_i->next->y;
-	}
-	if (check_collision(1))
-	{
-		new_tail = malloc(sizeof(struct segment_t));
-		if (!new_tail)
+		switch (opt)
 		{
-			printf("Ran out of memory.\n");
-			running = 0;
-			return;
-		}
-		new_tail->x = snake.tail->x;
-		new_tail->y = snake.tail->y;
-		new_tail->next = snake.tail;
-		snake.tail = new_tail;
-
-		while (check_collision(1))
-		{
-			apple.x = rand() % 8;
-			apple.y = rand() % 8;
+		case 't':
+			speed.base_ns = atol(optarg) * 1000000L;
+			break;
+		case 's':
+			speed.step_ns = atol(optarg) * 1000000L;
+			break;
+		case 'm':
+			speed.min_ns = atol(optarg) * 1000000L;
+			break;
+		case 'r':
+			seed = strtoul(optarg, NULL, 10);
+			break;
+		case 'T':
+			turbo_ticks = strtoul(optarg, NULL, 10);
+			break;
+		case 'a':
+			autoplay = 1;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-t tick_ms] [-s speedup_ms] [-m min_tick_ms] [-r seed] [-T turbo_ticks] [-a]\n", args[0]);
+			return EXIT_FAILURE;
 		}
 	}
-	switch (snake.heading)
-	{
-	case LEFT:
-		seg_i->y--;
-		break;
-	case DOWN:
-		seg_i->x++;
-		break;
-	case RIGHT:
-		seg_i->y++;
-		break;
-	case UP:
-		seg_i->x--;
-		break;
-	}
-}
-
-void reset(void)
-{
-	struct segment_t *seg_i;
-	struct segment_t *next_tail;
-	seg_i = snake.tail;
-	while (seg_i->next)
-	{
-		next_tail = seg_i->next;
-		free(seg_i);
-		seg_i = next_tail;
-	}
-	snake.tail = seg_i;
-	snake.tail->next = NULL;
-	snake.tail->x = 2;
-	snake.tail->y = 3;
-	apple.x = rand() % 8;
-	apple.y = rand() % 8;
-	snake.heading = NONE;
-}
-
-void change_dir(unsigned int code)
-{
-	switch (code)
+	if (speed.base_ns <= 0 || speed.min_ns <= 0)
 	{
-	case KEY_UP:
-		if (snake.heading != DOWN)
-			snake.heading = UP;
-		break;
-	case KEY_RIGHT:
-		if (snake.heading != LEFT)
-			snake.heading = RIGHT;
-		break;
-	case KEY_DOWN:
-		if (snake.heading != UP)
-			snake.heading = DOWN;
-		break;
-	case KEY_LEFT:
-		if (snake.heading != RIGHT)
-			snake.heading = LEFT;
-		break;
+		fprintf(stderr, "tick periods must be positive\n");
+		return EXIT_FAILURE;
 	}
-}
-
-void handle_events(int evfd)
-{
-	struct input_event ev[64];
-	int i, rd;
+	snake_seed(&game, seed);
 
-	rd = read(evfd, ev, sizeof(struct input_event) * 64);
-	if (rd < (int)sizeof(struct input_event))
+	//soak the engine without any hardware, display or sleeping
+	if (turbo_ticks)
 	{
-		fprintf(stderr, "expected %d bytes, got %d\n",
-				(int)sizeof(struct input_event), rd);
-		return;
-	}
-	for (i = 0; i < rd / sizeof(struct input_event); i++)
-	{
-		if (ev->type != EV_KEY)
-			continue;
-		if (ev->value != 1)
-			continue;
-		switch (ev->code)
-		{
-		case KEY_ENTER:
-			running = 0;
-			break;
-		default:
-			change_dir(ev->code);
-		}
+		turbo(&game, turbo_ticks);
+		return 0;
 	}
-}
-
-int main(int argc, char *args[])
-{
-	int ret = 0;
-	int fbfd = 0;
-	struct pollfd evpoll = {
-		.events = POLLIN,
-	};
-
-	srand(time(NULL));
 
 	evpoll.fd = open_evdev("Raspberry Pi Sense HAT Joystick");
 	if (evpoll.fd < 0)
@@ -323,32 +125,63 @@ int main(int argc, char *args[])
 		goto err_ev;
 	}
 
-	fb = mmap(0, 128, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
-	if (!fb)
+	map = mmap(0, 128, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
+	if (map == MAP_FAILED)
 	{
 		ret = EXIT_FAILURE;
 		printf("Failed to mmap.\n");
 		goto err_fb;
 	}
-	memset(fb, 0, 128);
+	frame_init(&frame, map);
 
-	snake.tail = &snake.head;
-	reset();
+	reset(&game);
+	if (input_thread_start(&input, evpoll.fd) < 0)
+	{
+		ret = EXIT_FAILURE;
+		perror("Error starting input thread");
+		goto err_map;
+	}
+	if (sched_init(&sched, snake_period(&game, &speed), input.wakefd) < 0)
+	{
+		input_thread_stop(&input);
+		ret = EXIT_FAILURE;
+		perror("Error creating tick timer");
+		goto err_map;
+	}
 	while (running)
 	{
-		while (poll(&evpoll, 1, 0) > 0)
-			handle_events(evpoll.fd);
-		game_logic();
-		if (check_collision(0))
+		events = sched_wait(&sched);
+		if (events < 0)
+			break;
+		if (events & SCHED_INPUT)
 		{
-			reset();
+			input_thread_ack(&input);
+			if (atomic_load(&input.quit))
+				running = 0;
 		}
-		render();
-		usleep(300000);
-	}
-	memset(fb, 0, 128);
-	reset();
-	munmap(fb, 128);
+		if (!(events & SCHED_TICK))
+			continue;
+		//fixed timestep, one step per deadline and a few extra to catch up when behind
+		steps = sched.expired < SNAKE_MAX_CATCHUP ? sched.expired : SNAKE_MAX_CATCHUP;
+		while (steps--)
+		{
+			if (autoplay)
+				change_dir(&game, snake_ai_key(&game));
+			else
+				snake_take_turn(&game, &input.queue);
+			snake_step(&game);
+		}
+		snake_render(&frame, &game);
+		if (snake_period(&game, &speed) != sched.period_ns)
+			sched_set_period(&sched, snake_period(&game, &speed));
+	}
+	sched_close(&sched);
+	input_thread_stop(&input);
+	fprintf(stderr, "%lu ticks, %lu missed deadlines\n", sched.ticks, sched.missed);
+	frame_clear(&frame);
+	frame_present(&frame);
+err_map:
+	munmap(map, 128);
 err_fb:
 	close(fbfd);
 err_ev:
@@ -0,0 +1,111 @@
+/*
+ *  Autoplayer for the snake engine.
+ *
+ *  snake_ai_key() picks the joystick key for the next move: the first step
+ *  of a shortest path to the apple found by BFS over the free cells, or,
+ *  when the apple is cut off, the next cell of a fixed Hamiltonian cycle
+ *  of the board, or failing that any free neighbour. It only reads the
+ *  engine state, so the game is driven exactly as a human would drive it,
+ *  through change_dir().
+ */
+#ifndef SNAKE_AI_H
+#define SNAKE_AI_H
+
+#include <stdint.h>
+#include <linux/input.h>
+
+#include "snake_engine.h"
+
+static const unsigned int ai_keys[4] = {KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT}; //by direction_t
+
+//neighbour of cell in direction d, -1 off the board
+static inline int ai_neighbour(int cell, int d)
+{
+    int x = CELL_X(cell), y = CELL_Y(cell);
+
+    switch (d)
+    {
+    case UP:
+        return x > 0 ? CELL(x - 1, y) : -1;
+    case RIGHT:
+        return y < 7 ? CELL(x, y + 1) : -1;
+    case DOWN:
+        return x < 7 ? CELL(x + 1, y) : -1;
+    case LEFT:
+        return y > 0 ? CELL(x, y - 1) : -1;
+    }
+    return -1;
+}
+
+//direction of the successor of cell on a cycle through all 64 cells: column 0 is the
+//way back up, columns 1 - 7 are swept in a serpentine from the top row down
+static inline int ai_cycle_dir(int cell)
+{
+    int x = CELL_X(cell), y = CELL_Y(cell);
+
+    if (y == 0)
+        return x == 0 ? RIGHT : UP;
+    if (x % 2 == 0)
+        return y == 7 ? DOWN : RIGHT;
+    if (y > 1)
+        return LEFT;
+    return x == 7 ? LEFT : DOWN;
+}
+
+static inline unsigned int snake_ai_key(const struct snake_game_t *g)
+{
+    uint8_t queue[SNAKE_CELLS];
+    int8_t first[SNAKE_CELLS]; //direction of the first move on the path to each cell
+    uint64_t blocked, seen;
+    int head = CELL(g->snake.x, g->snake.y);
+    int target = CELL(g->apple.x, g->apple.y);
+    int qh = 0, qt = 0, d, n, c;
+
+    //the tail moves out of the way this turn unless the snake is about to grow
+    blocked = g->snake.occupied;
+    if (!(g->snake.x == g->apple.x && g->snake.y == g->apple.y))
+        blocked &= ~CELL_BIT(snake_cell(g, 0));
+
+    seen = CELL_BIT(head);
+    for (d = 0; d < 4; d++)
+    {
+        n = ai_neighbour(head, d);
+        if (n < 0 || (blocked | seen) & CELL_BIT(n))
+            continue;
+        if (g->snake.length > 1 && d == (g->snake.heading + 2) % 4)
+            continue;
+        seen |= CELL_BIT(n);
+        first[n] = d;
+        queue[qt++] = n;
+    }
+    while (qh < qt)
+    {
+        c = queue[qh++];
+        if (c == target)
+            return ai_keys[(int)first[c]];
+        for (d = 0; d < 4; d++)
+        {
+            n = ai_neighbour(c, d);
+            if (n < 0 || (blocked | seen) & CELL_BIT(n))
+                continue;
+            seen |= CELL_BIT(n);
+            first[n] = first[c];
+            queue[qt++] = n;
+        }
+    }
+
+    //no way to the apple, keep to the cycle while it is clear, else take any free cell
+    d = ai_cycle_dir(head);
+    n = ai_neighbour(head, d);
+    if (n >= 0 && !(blocked & CELL_BIT(n)))
+        return ai_keys[d];
+    for (d = 0; d < 4; d++)
+    {
+        n = ai_neighbour(head, d);
+        if (n >= 0 && !(blocked & CELL_BIT(n)))
+            return ai_keys[d];
+    }
+    return ai_keys[g->snake.heading == NONE ? RIGHT : g->snake.heading];
+}
+
+#endif
@@ -0,0 +1,230 @@
+/*
+ *  Lane-parallel stepper for many snake boards at once.
+ *
+ *  SNAKE_LANES games are kept as a structure of arrays: one vector per
+ *  field, one lane per board, using GCC vector extensions so the same
+ *  source becomes AVX2/AVX-512 on x86 and NEON on the Pi. snake_batch_step()
+ *  moves every head, does the wall, self-collision and apple tests and
+ *  updates the occupancy masks for all lanes together, without branches.
+ *  Only the parts that are per-board by nature stay scalar: the write of
+ *  the new head into each body ring, and the apple draws and resets, which
+ *  walk just the lanes that need them by bit.
+ *
+ *  A lane behaves exactly like snake_step() on the same game, down to the
+ *  random number stream, so games can be moved in and out of a batch with
+ *  snake_batch_load()/snake_batch_store() at any tick.
+ *
+ *  Coordinates, lengths and flags sit in 32-bit lanes, so eight of them
+ *  fill one AVX2 register; only the occupancy masks are 64 bits wide and
+ *  comparison results are widened to them where they meet. The masks need
+ *  64-bit per-lane shifts, which AArch64 NEON and AVX2 have and plain SSE2
+ *  does not: there the compiler falls back to scalar code, slower than
+ *  snake_step(). Build with -march=native on x86, which also gives
+ *  select_bit() its BMI2 form for the apple draws.
+ */
+#ifndef SNAKE_BATCH_H
+#define SNAKE_BATCH_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "snake_engine.h"
+
+#define SNAKE_LANES 8
+
+//coordinates, lengths and flags fit 32-bit lanes, only the occupancy masks need 64
+typedef int32_t snake_lanes_t __attribute__((vector_size(SNAKE_LANES * sizeof(int32_t))));
+typedef int64_t snake_wide_t __attribute__((vector_size(SNAKE_LANES * sizeof(int64_t))));
+typedef uint64_t snake_bits_t __attribute__((vector_size(SNAKE_LANES * sizeof(uint64_t))));
+
+//vector literal with f(lane) in every lane, must list SNAKE_LANES entries
+#define SNAKE_LANES_OF(f) {f(0), f(1), f(2), f(3), f(4), f(5), f(6), f(7)}
+
+//vectors travel by pointer between the helpers, passing them by value would tie the
+//calling convention to whichever vector extensions the build happens to enable
+
+//v in the lanes set in m, keep elsewhere
+#define SNAKE_LANES_BLEND(m, v, keep) (((v) & (m)) | ((keep) & ~(m)))
+
+//a 32-bit lane mask or value widened to the mask lanes and back, -1 stays -1
+#define SNAKE_WIDEN(v) ((snake_bits_t)__builtin_convertvector((v), snake_wide_t))
+#define SNAKE_NARROW(v) __builtin_convertvector((snake_wide_t)(v), snake_lanes_t)
+
+//bit lane set for every lane of a comparison result that holds, for walking them with ctz
+static inline unsigned snake_lanes_bits(const snake_lanes_t *v)
+{
+    unsigned lane, bits = 0;
+
+    for (lane = 0; lane < SNAKE_LANES; lane++)
+        bits |= ((*v)[lane] & 1u) << lane;
+    return bits;
+}
+
+//snake_rand_next() on every lane of a vector of generator states, the draws into *out
+static inline void snake_lanes_rand(snake_bits_t *rng, snake_bits_t *out)
+{
+    snake_bits_t r = *rng;
+
+    r ^= r >> 12;
+    r ^= r << 25;
+    r ^= r >> 27;
+    *rng = r;
+    *out = (r * 0x2545F4914F6CDD1DULL) >> 32;
+}
+
+//the fields of struct snake_game_t, one lane per game
+struct snake_batch_t
+{
+    snake_lanes_t x;
+    snake_lanes_t y;
+    snake_lanes_t heading;
+    snake_lanes_t length;
+    snake_lanes_t tail;
+    snake_lanes_t crashed;
+    snake_lanes_t apple_x;
+    snake_lanes_t apple_y;
+    snake_bits_t occupied;
+    uint64_t rng[SNAKE_LANES];
+    uint8_t body[SNAKE_LANES][SNAKE_CELLS];
+};
+
+static inline void snake_batch_load(struct snake_batch_t *b, unsigned lane, const struct snake_game_t *g)
+{
+    b->x[lane] = g->snake.x;
+    b->y[lane] = g->snake.y;
+    b->heading[lane] = g->snake.heading;
+    b->length[lane] = g->snake.length;
+    b->tail[lane] = g->snake.tail;
+    b->crashed[lane] = g->snake.crashed;
+    b->apple_x[lane] = g->apple.x;
+    b->apple_y[lane] = g->apple.y;
+    b->occupied[lane] = g->snake.occupied;
+    b->rng[lane] = g->rng;
+    memcpy(b->body[lane], g->snake.body, SNAKE_CELLS);
+}
+
+static inline void snake_batch_store(const struct snake_batch_t *b, unsigned lane, struct snake_game_t *g)
+{
+    g->snake.x = b->x[lane];
+    g->snake.y = b->y[lane];
+    g->snake.heading = b->heading[lane];
+    g->snake.length = b->length[lane];
+    g->snake.tail = b->tail[lane];
+    g->snake.crashed = b->crashed[lane];
+    g->apple.x = b->apple_x[lane];
+    g->apple.y = b->apple_y[lane];
+    g->snake.occupied = b->occupied[lane];
+    g->rng = b->rng[lane];
+    memcpy(g->snake.body, b->body[lane], SNAKE_CELLS);
+}
+
+//change_dir() for one lane
+static inline void snake_batch_turn(struct snake_batch_t *b, unsigned lane, unsigned int code)
+{
+    b->heading[lane] = snake_turn(b->heading[lane], code);
+}
+
+//change_dir() on every lane with a key code per lane, 0 leaves a lane alone
+static inline void snake_batch_turns(struct snake_batch_t *b, const snake_lanes_t *key)
+{
+    snake_lanes_t h = b->heading, codes = *key, m;
+
+    //at most one key matches in a lane, so the order of the four does not matter
+    m = (codes == KEY_UP) & (h != DOWN);
+    h = (h & ~m) | (UP & m);
+    m = (codes == KEY_RIGHT) & (h != LEFT);
+    h = (h & ~m) | (RIGHT & m);
+    m = (codes == KEY_DOWN) & (h != UP);
+    h = (h & ~m) | (DOWN & m);
+    m = (codes == KEY_LEFT) & (h != RIGHT);
+    h = (h & ~m) | (LEFT & m);
+    b->heading = h;
+}
+
+static inline void snake_batch_place_apple(struct snake_batch_t *b, unsigned lane)
+{
+    uint8_t cell = snake_free_cell(b->occupied[lane], &b->rng[lane]);
+    b->apple_x[lane] = CELL_X(cell);
+    b->apple_y[lane] = CELL_Y(cell);
+}
+
+//reset() on the lanes set in end, except for the apple which needs each lane's generator
+static inline void snake_batch_reset(struct snake_batch_t *b, const snake_lanes_t *ended, unsigned lanes)
+{
+    const snake_lanes_t zero = {0};
+    snake_lanes_t end = *ended;
+
+    b->tail = SNAKE_LANES_BLEND(end, zero, b->tail);
+    b->length = SNAKE_LANES_BLEND(end, zero + 1, b->length);
+    b->x = SNAKE_LANES_BLEND(end, zero + SNAKE_START_X, b->x);
+    b->y = SNAKE_LANES_BLEND(end, zero + SNAKE_START_Y, b->y);
+    b->occupied = SNAKE_LANES_BLEND(SNAKE_WIDEN(end), (snake_bits_t){0} + CELL_BIT(CELL(SNAKE_START_X, SNAKE_START_Y)),
+                                    b->occupied);
+    b->crashed = SNAKE_LANES_BLEND(end, zero, b->crashed);
+    b->heading = SNAKE_LANES_BLEND(end, zero + NONE, b->heading);
+    for (; lanes; lanes &= lanes - 1)
+        b->body[__builtin_ctz(lanes)][0] = CELL(SNAKE_START_X, SNAKE_START_Y);
+}
+
+//snake_step() on every lane, returns how many rounds ended and were reset
+static inline unsigned snake_batch_step(struct snake_batch_t *b)
+{
+    snake_lanes_t h = b->heading, active, grow, pop, push, hit, in, end, place;
+    snake_lanes_t nx, ny, cell, slot, tail_cell;
+    snake_bits_t occupied = b->occupied, one = (snake_bits_t){0} + 1, bit;
+    unsigned lane, ends, places;
+
+    //comparisons give -1 in the lanes where they hold, 0 elsewhere
+    active = h != NONE;
+    grow = (b->x == b->apple_x) & (b->y == b->apple_y) & (b->length < SNAKE_CELLS);
+    nx = b->x + (h == UP) - (h == DOWN);
+    ny = b->y + (h == LEFT) - (h == RIGHT);
+
+    //drop the tail unless growing, a lane that is standing still keeps everything, the
+    //tail cells are gathered straight into a vector rather than lane by lane through memory
+#define TAIL_CELL(lane) b->body[lane][b->tail[lane]]
+    tail_cell = (snake_lanes_t)SNAKE_LANES_OF(TAIL_CELL);
+#undef TAIL_CELL
+    pop = active & ~grow;
+    bit = one << SNAKE_WIDEN(tail_cell);
+    occupied &= ~(bit & SNAKE_WIDEN(pop));
+    b->tail = (b->tail - pop) & (SNAKE_CELLS - 1);
+    b->length += pop;
+
+    //wall and body tests, the shift is masked so off-board lanes stay defined
+    in = ((nx | ny) & ~7) == 0;
+    cell = (nx << 3 | ny) & (SNAKE_CELLS - 1);
+    bit = one << SNAKE_WIDEN(cell);
+    hit = active & in & SNAKE_NARROW((occupied & bit) != 0);
+    push = active & in & ~hit;
+    occupied |= bit & SNAKE_WIDEN(push);
+    b->crashed |= hit & 1;
+    b->occupied = occupied;
+    b->x = nx;
+    b->y = ny;
+
+    //check_collision() on the moved head, then length after the push
+    end = (in == 0) | (b->crashed != 0);
+    //the slot just past the tail is dead in lanes that do not push, so every lane writes
+    slot = (b->tail + b->length) & (SNAKE_CELLS - 1);
+    b->length -= push;
+    end |= b->length == SNAKE_CELLS;
+    place = grow & push & (b->length < SNAKE_CELLS);
+    for (lane = 0; lane < SNAKE_LANES; lane++)
+        b->body[lane][slot[lane]] = cell[lane];
+
+    //a lane never both grows into a new apple and ends, so each draws at most one apple;
+    //the few lanes that need one are walked by bit rather than tested one by one
+    ends = snake_lanes_bits(&end);
+    place |= end;
+    places = snake_lanes_bits(&place);
+    if (places == 0)
+        return 0;
+    if (ends)
+        snake_batch_reset(b, &end, ends);
+    for (; places; places &= places - 1)
+        snake_batch_place_apple(b, __builtin_ctz(places));
+    return __builtin_popcount(ends);
+}
+
+#endif
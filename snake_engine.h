@@ -0,0 +1,282 @@
+/*
+ *  Snake game engine shared by snake.c, assignmentQ3.c and bench.c.
+ *
+ *  All state of one game lives in a struct snake_game_t, including its own
+ *  random number generator, so any number of independent games can run
+ *  side by side, on one thread or many.
+ *
+ *  The body lives in a fixed ring of 64 packed cells, tail first, so a
+ *  move is one head push plus one tail pop and the snake never touches
+ *  the heap. A 64-bit occupancy mask mirrors the ring, so collisions
+ *  are a bit test and a new apple is drawn uniformly from the free bits
+ *  in constant time however full the board is. Coordinates follow the
+ *  framebuffer: x is the row, y the column, both 0 - 7.
+ */
+#ifndef SNAKE_ENGINE_H
+#define SNAKE_ENGINE_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <linux/input.h>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+#include "input_queue.h"
+
+#define SNAKE_CELLS 64 //an 8x8 board can never hold a longer snake
+#define SNAKE_TICK_NS 300000000L //time between moves of a fresh snake
+#define SNAKE_MAX_CATCHUP 4       //steps run at most per wakeup when behind
+#define SNAKE_START_X 2
+#define SNAKE_START_Y 3
+
+#define CELL(x, y) ((uint8_t)((x) << 3 | (y)))
+#define CELL_X(c) ((c) >> 3)
+#define CELL_Y(c) ((c) & 7)
+#define CELL_BIT(c) (1ULL << (c))
+
+enum direction_t
+{
+    UP,
+    RIGHT,
+    DOWN,
+    LEFT,
+    NONE,
+};
+struct snake_t
+{
+    uint8_t body[SNAKE_CELLS]; //ring of packed cells, body[tail] is the tail
+    unsigned tail;
+    unsigned length;
+    uint64_t occupied; //CELL_BIT() of every cell in body
+    int x;             //head position, off the board after a move into the wall
+    int y;
+    int crashed;       //the last move ran the head into the body
+    enum direction_t heading;
+};
+struct apple_t
+{
+    int x;
+    int y;
+};
+struct snake_game_t
+{
+    struct snake_t snake;
+    struct apple_t apple;
+    uint64_t rng; //xorshift64* state, never 0
+};
+//difficulty curve, the tick period shrinks as the snake grows
+struct snake_speed_t
+{
+    long base_ns; //period of a one cell snake
+    long step_ns; //taken off the period per extra segment
+    long min_ns;  //fastest the game gets
+};
+
+#define SNAKE_SPEED_DEFAULT {SNAKE_TICK_NS, 5000000L, 150000000L}
+
+//seed the game's generator, nearby seeds give unrelated sequences
+static inline void snake_seed(struct snake_game_t *g, uint64_t seed)
+{
+    //splitmix64 finaliser
+    seed += 0x9E3779B97F4A7C15ULL;
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+    seed ^= seed >> 31;
+    g->rng = seed ? seed : 1;
+}
+
+//xorshift64* step on a bare state word, shared with the batch stepper
+static inline uint32_t snake_rand_next(uint64_t *rng)
+{
+    *rng ^= *rng >> 12;
+    *rng ^= *rng << 25;
+    *rng ^= *rng >> 27;
+    return (uint32_t)((*rng * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+static inline uint32_t snake_rand(struct snake_game_t *g)
+{
+    return snake_rand_next(&g->rng);
+}
+
+//packed cell i segments from the tail, i = length - 1 is the head
+static inline uint8_t snake_cell(const struct snake_game_t *g, unsigned i)
+{
+    return g->snake.body[(g->snake.tail + i) % SNAKE_CELLS];
+}
+
+//index of the r-th (from 0) set bit of v, v must have more than r bits set
+static inline int select_bit(uint64_t v, unsigned r)
+{
+#ifdef __BMI2__
+    //deposit bit r onto the set bits of v, one instruction on x86 since Haswell
+    return __builtin_ctzll(_pdep_u64(1ULL << r, v));
+#else
+    int base = 0;
+    unsigned n;
+
+    //skip whole bytes, then drop the remaining lower bits one at a time
+    while ((n = __builtin_popcountll(v & 0xFF)) <= r)
+    {
+        r -= n;
+        v >>= 8;
+        base += 8;
+    }
+    while (r--)
+        v &= v - 1;
+    return base + __builtin_ctzll(v);
+#endif
+}
+
+//uniformly chosen cell not in occupied, which must not be full
+static inline uint8_t snake_free_cell(uint64_t occupied, uint64_t *rng)
+{
+    uint64_t free_cells = ~occupied;
+    return select_bit(free_cells, snake_rand_next(rng) % __builtin_popcountll(free_cells));
+}
+
+//put the apple on a uniformly chosen free cell, the board must not be full
+static inline void place_apple(struct snake_game_t *g)
+{
+    uint8_t cell = snake_free_cell(g->snake.occupied, &g->rng);
+    g->apple.x = CELL_X(cell);
+    g->apple.y = CELL_Y(cell);
+}
+
+static inline int check_collision(const struct snake_game_t *g, int appleCheck)
+{
+    const struct snake_t *snake = &g->snake;
+
+    if (appleCheck)
+        return (snake->occupied & CELL_BIT(CELL(g->apple.x, g->apple.y))) != 0;
+
+    if (snake->x < 0 || snake->x > 7 ||
+        snake->y < 0 || snake->y > 7)
+    {
+        return 1;
+    }
+    //a snake filling the whole board has nowhere left to go, start over
+    return snake->crashed || snake->length == SNAKE_CELLS;
+}
+
+static inline void game_logic(struct snake_game_t *g)
+{
+    struct snake_t *snake = &g->snake;
+    //the head reached the apple on the previous move, keep the tail this time
+    int grow = snake->x == g->apple.x && snake->y == g->apple.y && snake->length < SNAKE_CELLS;
+
+    switch (snake->heading)
+    {
+    case LEFT:
+        snake->y--;
+        break;
+    case DOWN:
+        snake->x++;
+        break;
+    case RIGHT:
+        snake->y++;
+        break;
+    case UP:
+        snake->x--;
+        break;
+    case NONE:
+        return;
+    }
+
+    if (!grow)
+    {
+        snake->occupied &= ~CELL_BIT(snake->body[snake->tail]);
+        snake->tail = (snake->tail + 1) % SNAKE_CELLS;
+        snake->length--;
+    }
+    //a head outside the board or inside the body is left for check_collision() to report
+    if (snake->x < 0 || snake->x > 7 || snake->y < 0 || snake->y > 7)
+        return;
+    if (snake->occupied & CELL_BIT(CELL(snake->x, snake->y)))
+    {
+        snake->crashed = 1;
+        return;
+    }
+    snake->body[(snake->tail + snake->length) % SNAKE_CELLS] = CELL(snake->x, snake->y);
+    snake->occupied |= CELL_BIT(CELL(snake->x, snake->y));
+    snake->length++;
+
+    if (grow && snake->length < SNAKE_CELLS)
+        place_apple(g);
+}
+
+static inline void reset(struct snake_game_t *g)
+{
+    struct snake_t *snake = &g->snake;
+
+    snake->tail = 0;
+    snake->length = 1;
+    snake->x = SNAKE_START_X;
+    snake->y = SNAKE_START_Y;
+    snake->body[0] = CELL(snake->x, snake->y);
+    snake->occupied = CELL_BIT(snake->body[0]);
+    snake->crashed = 0;
+    place_apple(g);
+    snake->heading = NONE;
+}
+
+//one fixed simulation step, returns 1 when the round ended and the board was reset
+static inline int snake_step(struct snake_game_t *g)
+{
+    game_logic(g);
+    if (check_collision(g, 0))
+    {
+        reset(g);
+        return 1;
+    }
+    return 0;
+}
+
+//tick period for the current length
+static inline long snake_period(const struct snake_game_t *g, const struct snake_speed_t *sp)
+{
+    long ns = sp->base_ns - sp->step_ns * (long)(g->snake.length - 1);
+    return ns < sp->min_ns ? sp->min_ns : ns;
+}
+
+//heading after the joystick key code, a snake never reverses onto itself
+static inline enum direction_t snake_turn(enum direction_t heading, unsigned int code)
+{
+    switch (code)
+    {
+    case KEY_UP:
+        return heading != DOWN ? UP : heading;
+    case KEY_RIGHT:
+        return heading != LEFT ? RIGHT : heading;
+    case KEY_DOWN:
+        return heading != UP ? DOWN : heading;
+    case KEY_LEFT:
+        return heading != RIGHT ? LEFT : heading;
+    }
+    return heading;
+}
+
+//returns 1 if the heading changed
+static inline int change_dir(struct snake_game_t *g, unsigned int code)
+{
+    enum direction_t old = g->snake.heading;
+
+    g->snake.heading = snake_turn(old, code);
+    return g->snake.heading != old;
+}
+
+//apply queued turns in order until one changes the heading, the rest are left for later
+//ticks so a quick double turn takes effect over two moves instead of being lost
+static inline void snake_take_turn(struct snake_game_t *g, struct input_queue_t *q)
+{
+    unsigned short code;
+
+    while (input_pop(q, &code))
+    {
+        if (change_dir(g, code))
+            break;
+    }
+}
+
+#endif
@@ -0,0 +1,28 @@
+/*
+ *  Drawing of a snake game onto a frame, shared by snake.c and bench.c.
+ *
+ *  The apple is red, the body green and the head white on black, and the
+ *  result goes to the device through frame_present(), so only the words
+ *  that changed since the last move are written.
+ */
+#ifndef SNAKE_RENDER_H
+#define SNAKE_RENDER_H
+
+#include <stdint.h>
+
+#include "pixel_ops.h"
+#include "frame.h"
+#include "snake_engine.h"
+
+static inline void snake_render(struct frame_t *frame, const struct snake_game_t *g)
+{
+    uint64_t head = CELL_BIT(CELL(g->snake.x, g->snake.y));
+
+    frame_clear(frame);
+    frame->back.pixel[g->apple.x][g->apple.y] = 0xF800;
+    px_cells_over(frame_pixels(frame), g->snake.occupied & ~head, 0x7E0);
+    frame->back.pixel[g->snake.x][g->snake.y] = 0xFFFF;
+    frame_present(frame);
+}
+
+#endif
@@ -0,0 +1,399 @@
+/*
+ *  Indexed store of named 8x8 sprites and animations, plus a player.
+ *
+ *  The file starts with a fixed-capacity index: one entry per sprite with
+ *  its name, the file offset of its first frame and its frame count. The
+ *  frames follow, each with its own display time. Opening the store reads
+ *  only the header and the index; a frame is read from the file the first
+ *  time it is asked for and then kept in a small direct-mapped cache, so
+ *  playback touches just the frames it shows.
+ *
+ *  Each sprite owns an extent of capacity frames, of which the first
+ *  frames are in use. A new frame goes into the extent when there is
+ *  room; when there is not, the sprite moves to a new extent at the end
+ *  of the file, twice as large, so building an animation frame by frame
+ *  copies each frame only a few times. A frame is written and synced
+ *  before the index entry that counts it, so a crash leaves either the
+ *  old sprite or the new one.
+ *
+ *  The extents sprites have moved out of are dead space. When opening
+ *  finds more than a third of the file dead, the store is compacted: the
+ *  live extents are copied back to back into a temporary file, which is
+ *  synced and renamed over the old one. Version 1 files, which had no
+ *  capacity, are compacted into the current format the same way.
+ *
+ *  Playback does not block and draws nothing itself: sprite_player_start()
+ *  sets up a position and each sprite_player_next() hands back the next
+ *  frame with its display time, for the caller's own timer to pace and
+ *  its own display path to show.
+ */
+#ifndef SPRITE_STORE_H
+#define SPRITE_STORE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "pixel_ops.h"
+
+#define SPRITE_FILE "sprites.bin"
+#define SPRITE_MAGIC "RPIS"
+#define SPRITE_VERSION 2
+#define SPRITE_MAX 512   //index entries
+#define SPRITE_NAME 24   //bytes of name, NUL padded
+#define SPRITE_CACHE 32  //cached frames, power of two
+#define SPRITE_MAX_FRAMES 1024
+#define SPRITE_COMPACT_MIN 64 //frames of dead space worth a compaction at open
+
+struct sprite_header_t
+{
+    char magic[4];
+    uint16_t version;
+    uint16_t entry_size; //sizeof(struct sprite_entry_t)
+    uint32_t count;      //entries in use
+    uint32_t capacity;   //SPRITE_MAX
+};
+
+struct sprite_entry_t
+{
+    char name[SPRITE_NAME];
+    uint32_t offset;   //of the first frame
+    uint16_t frames;
+    uint16_t capacity; //frames the extent at offset holds, 0 in version 1 files
+};
+
+struct sprite_frame_t
+{
+    uint16_t duration_ms; //how long the frame stays up
+    uint16_t reserved;
+    uint16_t pixel[PX_COUNT];
+};
+
+struct sprite_store_t
+{
+    int fd;
+    uint32_t end; //where the next extent goes
+    struct sprite_header_t header;
+    struct sprite_entry_t index[SPRITE_MAX];
+    struct
+    {
+        uint32_t offset; //0 for an empty slot, no frame lives inside the index
+        struct sprite_frame_t frame;
+    } cache[SPRITE_CACHE];
+    unsigned long hits, misses;
+};
+
+//playback position, stepped by sprite_player_next() from whatever loop paces the frames
+struct sprite_player_t
+{
+    int id;
+    unsigned frame, loop, loops;
+};
+
+#define SPRITE_DATA (sizeof(struct sprite_header_t) + SPRITE_MAX * sizeof(struct sprite_entry_t))
+
+static inline unsigned sprite_capacity(const struct sprite_entry_t *e)
+{
+    return e->capacity > e->frames ? e->capacity : e->frames;
+}
+
+//sync the directory holding path, so a rename in it survives a crash
+static inline void sprite_sync_dir(const char *path)
+{
+    char dir[PATH_MAX], *slash;
+    int fd;
+
+    snprintf(dir, sizeof(dir), "%s", path);
+    slash = strrchr(dir, '/');
+    if (slash == NULL)
+        strcpy(dir, ".");
+    else if (slash == dir)
+        dir[1] = '\0';
+    else
+        *slash = '\0';
+    fd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0)
+    {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+//rewrite the store at path with the extents back to back and no dead space between them
+static inline int sprite_compact(struct sprite_store_t *st, const char *path)
+{
+    struct sprite_entry_t index[SPRITE_MAX];
+    struct sprite_frame_t f;
+    char tmp[PATH_MAX];
+    uint32_t at = SPRITE_DATA, i, n;
+    int fd;
+
+    if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp))
+        return -1;
+    fd = open(tmp, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+        return -1;
+    memcpy(index, st->index, st->header.count * sizeof(*index));
+    for (i = 0; i < st->header.count; i++)
+    {
+        for (n = 0; n < index[i].frames; n++)
+        {
+            if (pread(st->fd, &f, sizeof(f), index[i].offset + n * sizeof(f)) != sizeof(f) ||
+                pwrite(fd, &f, sizeof(f), at + n * sizeof(f)) != sizeof(f))
+                goto err;
+        }
+        index[i].capacity = sprite_capacity(&index[i]);
+        index[i].offset = at;
+        at += index[i].capacity * sizeof(f);
+    }
+    st->header.version = SPRITE_VERSION;
+    if (pwrite(fd, &st->header, sizeof(st->header), 0) != sizeof(st->header) ||
+        pwrite(fd, index, st->header.count * sizeof(*index), sizeof(st->header)) !=
+            (ssize_t)(st->header.count * sizeof(*index)) ||
+        ftruncate(fd, at) < 0 || fsync(fd) < 0 || rename(tmp, path) < 0)
+        goto err;
+    sprite_sync_dir(path);
+
+    close(st->fd);
+    st->fd = fd;
+    memcpy(st->index, index, st->header.count * sizeof(*index));
+    st->end = at;
+    return 0;
+
+err:
+    close(fd);
+    unlink(tmp);
+    return -1;
+}
+
+//open or create the store at path, reading nothing past the index; compacts it first
+//when much of the file is dead space
+static inline int sprite_open(struct sprite_store_t *st, const char *path)
+{
+    struct stat sb;
+    size_t index_bytes;
+    uint64_t live = 0, dead = 0, extent;
+    uint32_t i;
+    int upgrade;
+
+    memset(st, 0, sizeof(*st));
+    st->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (st->fd < 0)
+        return -1;
+    if (fstat(st->fd, &sb) < 0)
+        goto err;
+
+    if (sb.st_size == 0)
+    {
+        memcpy(st->header.magic, SPRITE_MAGIC, 4);
+        st->header.version = SPRITE_VERSION;
+        st->header.entry_size = sizeof(struct sprite_entry_t);
+        st->header.capacity = SPRITE_MAX;
+        if (pwrite(st->fd, &st->header, sizeof(st->header), 0) != sizeof(st->header) ||
+            ftruncate(st->fd, SPRITE_DATA) < 0 || fsync(st->fd) < 0)
+            goto err;
+        st->end = SPRITE_DATA;
+        return 0;
+    }
+
+    if (pread(st->fd, &st->header, sizeof(st->header), 0) != sizeof(st->header) ||
+        memcmp(st->header.magic, SPRITE_MAGIC, 4) != 0 ||
+        (st->header.version != SPRITE_VERSION && st->header.version != 1) ||
+        st->header.entry_size != sizeof(struct sprite_entry_t) || st->header.capacity != SPRITE_MAX ||
+        st->header.count > SPRITE_MAX || sb.st_size < (off_t)SPRITE_DATA)
+    {
+        errno = EINVAL;
+        goto err;
+    }
+    index_bytes = st->header.count * sizeof(struct sprite_entry_t);
+    if (pread(st->fd, st->index, index_bytes, sizeof(st->header)) != (ssize_t)index_bytes)
+        goto err;
+    st->end = sb.st_size;
+    for (i = 0; i < st->header.count; i++)
+    {
+        //version 1 wrote 0 there, which sprite_capacity() reads as just the frames in use
+        if (st->header.version == 1)
+            st->index[i].capacity = 0;
+        extent = sprite_capacity(&st->index[i]) * sizeof(struct sprite_frame_t);
+        live += extent;
+        //a reservation the file was never extended over still belongs to its sprite
+        if (st->index[i].offset + extent > st->end)
+            st->end = st->index[i].offset + extent;
+    }
+
+    if (st->end - SPRITE_DATA > live)
+        dead = st->end - SPRITE_DATA - live;
+    upgrade = st->header.version == 1;
+    if (upgrade || (2 * dead > live && dead >= SPRITE_COMPACT_MIN * sizeof(struct sprite_frame_t)))
+    {
+        //a version 1 file must not be extended in the new format, only compacted into it
+        if (sprite_compact(st, path) < 0 && upgrade)
+            goto err;
+    }
+    return 0;
+
+err:
+    close(st->fd);
+    return -1;
+}
+
+static inline void sprite_close(struct sprite_store_t *st)
+{
+    close(st->fd);
+}
+
+//index of the sprite called name, -1 if there is none
+static inline int sprite_find(const struct sprite_store_t *st, const char *name)
+{
+    uint32_t i;
+
+    for (i = 0; i < st->header.count; i++)
+    {
+        if (strncmp(st->index[i].name, name, SPRITE_NAME) == 0)
+            return i;
+    }
+    return -1;
+}
+
+//frame n of sprite id, read on first use, NULL on a read error or out of range
+static inline const struct sprite_frame_t *sprite_frame(struct sprite_store_t *st, int id, unsigned n)
+{
+    uint32_t offset;
+    unsigned slot;
+    ssize_t got;
+
+    if (id < 0 || (uint32_t)id >= st->header.count || n >= st->index[id].frames)
+        return NULL;
+    offset = st->index[id].offset + n * sizeof(struct sprite_frame_t);
+    slot = (offset / sizeof(struct sprite_frame_t)) & (SPRITE_CACHE - 1);
+    if (st->cache[slot].offset == offset)
+    {
+        st->hits++;
+        return &st->cache[slot].frame;
+    }
+    st->misses++;
+    st->cache[slot].offset = 0;
+    got = pread(st->fd, &st->cache[slot].frame, sizeof(struct sprite_frame_t), offset);
+    if (got != sizeof(struct sprite_frame_t))
+    {
+        if (got >= 0)
+            errno = EIO; //cut off
+        return NULL;
+    }
+    st->cache[slot].offset = offset;
+    return &st->cache[slot].frame;
+}
+
+//add a frame to the end of sprite name, creating it if need be; returns the sprite's index
+static inline int sprite_append(struct sprite_store_t *st, const char *name, const uint16_t *pixel, unsigned duration_ms)
+{
+    struct sprite_entry_t entry;
+    struct sprite_frame_t f;
+    const struct sprite_frame_t *old;
+    uint32_t end = st->end, i;
+    unsigned capacity;
+    int id = sprite_find(st, name);
+
+    if (id < 0)
+    {
+        if (st->header.count == SPRITE_MAX)
+        {
+            errno = ENOSPC;
+            return -1;
+        }
+        memset(&entry, 0, sizeof(entry));
+        memcpy(entry.name, name, strnlen(name, SPRITE_NAME));
+    }
+    else
+    {
+        entry = st->index[id];
+        if (entry.frames == SPRITE_MAX_FRAMES)
+        {
+            errno = EFBIG;
+            return -1;
+        }
+    }
+
+    //a full extent moves to the end of the file at twice the size, frames and all
+    capacity = sprite_capacity(&entry);
+    if (entry.frames == capacity)
+    {
+        capacity = capacity ? 2 * capacity : 1;
+        if (capacity > SPRITE_MAX_FRAMES)
+            capacity = SPRITE_MAX_FRAMES;
+        for (i = 0; i < entry.frames; i++)
+        {
+            old = sprite_frame(st, id, i);
+            if (old == NULL || pwrite(st->fd, old, sizeof(*old), st->end + i * sizeof(*old)) != sizeof(*old))
+                return -1;
+        }
+        entry.offset = st->end;
+        end = st->end + capacity * sizeof(f);
+        if (ftruncate(st->fd, end) < 0)
+            return -1;
+    }
+    memset(&f, 0, sizeof(f));
+    f.duration_ms = duration_ms > UINT16_MAX ? UINT16_MAX : duration_ms;
+    px_copy(f.pixel, pixel);
+    if (pwrite(st->fd, &f, sizeof(f), entry.offset + entry.frames * sizeof(f)) != sizeof(f) || fsync(st->fd) < 0)
+        return -1;
+
+    //the frames are safely down, now point the index at them
+    entry.frames++;
+    entry.capacity = capacity;
+    if (id < 0)
+        id = st->header.count;
+    if (pwrite(st->fd, &entry, sizeof(entry), sizeof(st->header) + id * sizeof(entry)) != sizeof(entry))
+        return -1;
+    if ((uint32_t)id == st->header.count)
+    {
+        st->header.count++;
+        if (pwrite(st->fd, &st->header, sizeof(st->header), 0) != sizeof(st->header))
+        {
+            st->header.count--;
+            return -1;
+        }
+    }
+    if (fsync(st->fd) < 0)
+        return -1;
+    st->index[id] = entry;
+    st->end = end;
+    return id;
+}
+
+//play sprite id loops times, 0 for once
+static inline void sprite_player_start(struct sprite_player_t *p, int id, unsigned loops)
+{
+    p->id = id;
+    p->frame = 0;
+    p->loop = 0;
+    p->loops = loops ? loops : 1;
+}
+
+//the frame to show next, NULL once the last loop is done or on a read error (errno set)
+static inline const struct sprite_frame_t *sprite_player_next(struct sprite_store_t *st, struct sprite_player_t *p)
+{
+    if (p->id < 0 || (uint32_t)p->id >= st->header.count)
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+    if (p->frame == st->index[p->id].frames)
+    {
+        p->frame = 0;
+        p->loop++;
+    }
+    if (p->loop == p->loops)
+    {
+        errno = 0;
+        return NULL;
+    }
+    return sprite_frame(st, p->id, p->frame++);
+}
+
+#endif